@@ -51,17 +51,17 @@ OBJECTDIR=build/${CND_CONF}/${IMAGE_TYPE}
 DISTDIR=dist/${CND_CONF}/${IMAGE_TYPE}
 
 # Source Files Quoted if spaced
-SOURCEFILES_QUOTED_IF_SPACED=../src/config/default/peripheral/adc/plib_adc.c ../src/config/default/peripheral/eic/plib_eic.c ../src/config/default/peripheral/nvic/plib_nvic.c ../src/config/default/peripheral/port/plib_port.c ../src/config/default/peripheral/sercom/i2c_master/plib_sercom1_i2c_master.c ../src/config/default/peripheral/sercom/spi_master/plib_sercom2_spi_master.c ../src/config/default/peripheral/sercom/usart/plib_sercom0_usart.c ../src/config/default/peripheral/sercom/usart/plib_sercom3_usart.c ../src/config/default/peripheral/systick/plib_systick.c ../src/config/default/peripheral/tcc/plib_tcc0.c ../src/config/default/peripheral/tcc/plib_tcc1.c ../src/config/default/stdio/xc32_monitor.c ../src/config/default/initialization.c ../src/config/default/interrupts.c ../src/config/default/exceptions.c ../src/config/default/startup_xc32.c ../src/config/default/libc_syscalls.c ../src/cores/i2c.c ../src/cores/spi.c ../src/cores/uart.c ../src/cores/systick.c ../src/cores/adc.c ../src/cores/pwm.c ../src/drivers/ssd1362.c ../src/drivers/sen6x.c ../src/drivers/m95.c ../src/drivers/buzzer.c ../src/drivers/hid.c ../src/drivers/led.c ../src/processes/alert.c ../src/ui/assets.c ../src/ui/fonts.c ../src/ui/widgets.c ../src/ui/pages.c ../src/utils/utils.c ../src/utils/adc_processing.c ../src/main.c ../src/config/default/peripheral/dmac/plib_dmac.c
+SOURCEFILES_QUOTED_IF_SPACED=../src/config/default/peripheral/adc/plib_adc.c ../src/config/default/peripheral/eic/plib_eic.c ../src/config/default/peripheral/nvic/plib_nvic.c ../src/config/default/peripheral/port/plib_port.c ../src/config/default/peripheral/sercom/i2c_master/plib_sercom1_i2c_master.c ../src/config/default/peripheral/sercom/spi_master/plib_sercom2_spi_master.c ../src/config/default/peripheral/sercom/usart/plib_sercom0_usart.c ../src/config/default/peripheral/sercom/usart/plib_sercom3_usart.c ../src/config/default/peripheral/systick/plib_systick.c ../src/config/default/peripheral/tcc/plib_tcc0.c ../src/config/default/peripheral/tcc/plib_tcc1.c ../src/config/default/stdio/xc32_monitor.c ../src/config/default/initialization.c ../src/config/default/interrupts.c ../src/config/default/exceptions.c ../src/config/default/startup_xc32.c ../src/config/default/libc_syscalls.c ../src/cores/i2c.c ../src/cores/spi.c ../src/cores/uart.c ../src/cores/systick.c ../src/cores/adc.c ../src/cores/pwm.c ../src/drivers/ssd1362.c ../src/drivers/sen6x.c ../src/drivers/m95.c ../src/drivers/buzzer.c ../src/drivers/hid.c ../src/drivers/led.c ../src/processes/alert.c ../src/processes/history.c ../src/ui/assets.c ../src/ui/fonts.c ../src/ui/widgets.c ../src/ui/pages.c ../src/utils/utils.c ../src/utils/adc_processing.c ../src/main.c ../src/config/default/peripheral/dmac/plib_dmac.c
 
 # Object Files Quoted if spaced
-OBJECTFILES_QUOTED_IF_SPACED=${OBJECTDIR}/_ext/60163342/plib_adc.o ${OBJECTDIR}/_ext/60167341/plib_eic.o ${OBJECTDIR}/_ext/1865468468/plib_nvic.o ${OBJECTDIR}/_ext/1865521619/plib_port.o ${OBJECTDIR}/_ext/508257091/plib_sercom1_i2c_master.o ${OBJECTDIR}/_ext/17022449/plib_sercom2_spi_master.o ${OBJECTDIR}/_ext/504274921/plib_sercom0_usart.o ${OBJECTDIR}/_ext/504274921/plib_sercom3_usart.o ${OBJECTDIR}/_ext/1827571544/plib_systick.o ${OBJECTDIR}/_ext/60181570/plib_tcc0.o ${OBJECTDIR}/_ext/60181570/plib_tcc1.o ${OBJECTDIR}/_ext/163028504/xc32_monitor.o ${OBJECTDIR}/_ext/1171490990/initialization.o ${OBJECTDIR}/_ext/1171490990/interrupts.o ${OBJECTDIR}/_ext/1171490990/exceptions.o ${OBJECTDIR}/_ext/1171490990/startup_xc32.o ${OBJECTDIR}/_ext/1171490990/libc_syscalls.o ${OBJECTDIR}/_ext/1536727238/i2c.o ${OBJECTDIR}/_ext/1536727238/spi.o ${OBJECTDIR}/_ext/1536727238/uart.o ${OBJECTDIR}/_ext/1536727238/systick.o ${OBJECTDIR}/_ext/1536727238/adc.o ${OBJECTDIR}/_ext/1536727238/pwm.o ${OBJECTDIR}/_ext/1639450193/ssd1362.o ${OBJECTDIR}/_ext/1639450193/sen6x.o ${OBJECTDIR}/_ext/1639450193/m95.o ${OBJECTDIR}/_ext/1639450193/buzzer.o ${OBJECTDIR}/_ext/1639450193/hid.o ${OBJECTDIR}/_ext/1639450193/led.o ${OBJECTDIR}/_ext/469845277/alert.o ${OBJECTDIR}/_ext/809997874/assets.o ${OBJECTDIR}/_ext/809997874/fonts.o ${OBJECTDIR}/_ext/809997874/widgets.o ${OBJECTDIR}/_ext/809997874/pages.o ${OBJECTDIR}/_ext/1519963337/utils.o ${OBJECTDIR}/_ext/1519963337/adc_processing.o ${OBJECTDIR}/_ext/1360937237/main.o ${OBJECTDIR}/_ext/1865161661/plib_dmac.o
-POSSIBLE_DEPFILES=${OBJECTDIR}/_ext/60163342/plib_adc.o.d ${OBJECTDIR}/_ext/60167341/plib_eic.o.d ${OBJECTDIR}/_ext/1865468468/plib_nvic.o.d ${OBJECTDIR}/_ext/1865521619/plib_port.o.d ${OBJECTDIR}/_ext/508257091/plib_sercom1_i2c_master.o.d ${OBJECTDIR}/_ext/17022449/plib_sercom2_spi_master.o.d ${OBJECTDIR}/_ext/504274921/plib_sercom0_usart.o.d ${OBJECTDIR}/_ext/504274921/plib_sercom3_usart.o.d ${OBJECTDIR}/_ext/1827571544/plib_systick.o.d ${OBJECTDIR}/_ext/60181570/plib_tcc0.o.d ${OBJECTDIR}/_ext/60181570/plib_tcc1.o.d ${OBJECTDIR}/_ext/163028504/xc32_monitor.o.d ${OBJECTDIR}/_ext/1171490990/initialization.o.d ${OBJECTDIR}/_ext/1171490990/interrupts.o.d ${OBJECTDIR}/_ext/1171490990/exceptions.o.d ${OBJECTDIR}/_ext/1171490990/startup_xc32.o.d ${OBJECTDIR}/_ext/1171490990/libc_syscalls.o.d ${OBJECTDIR}/_ext/1536727238/i2c.o.d ${OBJECTDIR}/_ext/1536727238/spi.o.d ${OBJECTDIR}/_ext/1536727238/uart.o.d ${OBJECTDIR}/_ext/1536727238/systick.o.d ${OBJECTDIR}/_ext/1536727238/adc.o.d ${OBJECTDIR}/_ext/1536727238/pwm.o.d ${OBJECTDIR}/_ext/1639450193/ssd1362.o.d ${OBJECTDIR}/_ext/1639450193/sen6x.o.d ${OBJECTDIR}/_ext/1639450193/m95.o.d ${OBJECTDIR}/_ext/1639450193/buzzer.o.d ${OBJECTDIR}/_ext/1639450193/hid.o.d ${OBJECTDIR}/_ext/1639450193/led.o.d ${OBJECTDIR}/_ext/469845277/alert.o.d ${OBJECTDIR}/_ext/809997874/assets.o.d ${OBJECTDIR}/_ext/809997874/fonts.o.d ${OBJECTDIR}/_ext/809997874/widgets.o.d ${OBJECTDIR}/_ext/809997874/pages.o.d ${OBJECTDIR}/_ext/1519963337/utils.o.d ${OBJECTDIR}/_ext/1519963337/adc_processing.o.d ${OBJECTDIR}/_ext/1360937237/main.o.d ${OBJECTDIR}/_ext/1865161661/plib_dmac.o.d
+OBJECTFILES_QUOTED_IF_SPACED=${OBJECTDIR}/_ext/60163342/plib_adc.o ${OBJECTDIR}/_ext/60167341/plib_eic.o ${OBJECTDIR}/_ext/1865468468/plib_nvic.o ${OBJECTDIR}/_ext/1865521619/plib_port.o ${OBJECTDIR}/_ext/508257091/plib_sercom1_i2c_master.o ${OBJECTDIR}/_ext/17022449/plib_sercom2_spi_master.o ${OBJECTDIR}/_ext/504274921/plib_sercom0_usart.o ${OBJECTDIR}/_ext/504274921/plib_sercom3_usart.o ${OBJECTDIR}/_ext/1827571544/plib_systick.o ${OBJECTDIR}/_ext/60181570/plib_tcc0.o ${OBJECTDIR}/_ext/60181570/plib_tcc1.o ${OBJECTDIR}/_ext/163028504/xc32_monitor.o ${OBJECTDIR}/_ext/1171490990/initialization.o ${OBJECTDIR}/_ext/1171490990/interrupts.o ${OBJECTDIR}/_ext/1171490990/exceptions.o ${OBJECTDIR}/_ext/1171490990/startup_xc32.o ${OBJECTDIR}/_ext/1171490990/libc_syscalls.o ${OBJECTDIR}/_ext/1536727238/i2c.o ${OBJECTDIR}/_ext/1536727238/spi.o ${OBJECTDIR}/_ext/1536727238/uart.o ${OBJECTDIR}/_ext/1536727238/systick.o ${OBJECTDIR}/_ext/1536727238/adc.o ${OBJECTDIR}/_ext/1536727238/pwm.o ${OBJECTDIR}/_ext/1639450193/ssd1362.o ${OBJECTDIR}/_ext/1639450193/sen6x.o ${OBJECTDIR}/_ext/1639450193/m95.o ${OBJECTDIR}/_ext/1639450193/buzzer.o ${OBJECTDIR}/_ext/1639450193/hid.o ${OBJECTDIR}/_ext/1639450193/led.o ${OBJECTDIR}/_ext/469845277/alert.o ${OBJECTDIR}/_ext/469845277/history.o ${OBJECTDIR}/_ext/809997874/assets.o ${OBJECTDIR}/_ext/809997874/fonts.o ${OBJECTDIR}/_ext/809997874/widgets.o ${OBJECTDIR}/_ext/809997874/pages.o ${OBJECTDIR}/_ext/1519963337/utils.o ${OBJECTDIR}/_ext/1519963337/adc_processing.o ${OBJECTDIR}/_ext/1360937237/main.o ${OBJECTDIR}/_ext/1865161661/plib_dmac.o
+POSSIBLE_DEPFILES=${OBJECTDIR}/_ext/60163342/plib_adc.o.d ${OBJECTDIR}/_ext/60167341/plib_eic.o.d ${OBJECTDIR}/_ext/1865468468/plib_nvic.o.d ${OBJECTDIR}/_ext/1865521619/plib_port.o.d ${OBJECTDIR}/_ext/508257091/plib_sercom1_i2c_master.o.d ${OBJECTDIR}/_ext/17022449/plib_sercom2_spi_master.o.d ${OBJECTDIR}/_ext/504274921/plib_sercom0_usart.o.d ${OBJECTDIR}/_ext/504274921/plib_sercom3_usart.o.d ${OBJECTDIR}/_ext/1827571544/plib_systick.o.d ${OBJECTDIR}/_ext/60181570/plib_tcc0.o.d ${OBJECTDIR}/_ext/60181570/plib_tcc1.o.d ${OBJECTDIR}/_ext/163028504/xc32_monitor.o.d ${OBJECTDIR}/_ext/1171490990/initialization.o.d ${OBJECTDIR}/_ext/1171490990/interrupts.o.d ${OBJECTDIR}/_ext/1171490990/exceptions.o.d ${OBJECTDIR}/_ext/1171490990/startup_xc32.o.d ${OBJECTDIR}/_ext/1171490990/libc_syscalls.o.d ${OBJECTDIR}/_ext/1536727238/i2c.o.d ${OBJECTDIR}/_ext/1536727238/spi.o.d ${OBJECTDIR}/_ext/1536727238/uart.o.d ${OBJECTDIR}/_ext/1536727238/systick.o.d ${OBJECTDIR}/_ext/1536727238/adc.o.d ${OBJECTDIR}/_ext/1536727238/pwm.o.d ${OBJECTDIR}/_ext/1639450193/ssd1362.o.d ${OBJECTDIR}/_ext/1639450193/sen6x.o.d ${OBJECTDIR}/_ext/1639450193/m95.o.d ${OBJECTDIR}/_ext/1639450193/buzzer.o.d ${OBJECTDIR}/_ext/1639450193/hid.o.d ${OBJECTDIR}/_ext/1639450193/led.o.d ${OBJECTDIR}/_ext/469845277/alert.o.d ${OBJECTDIR}/_ext/469845277/history.o.d ${OBJECTDIR}/_ext/809997874/assets.o.d ${OBJECTDIR}/_ext/809997874/fonts.o.d ${OBJECTDIR}/_ext/809997874/widgets.o.d ${OBJECTDIR}/_ext/809997874/pages.o.d ${OBJECTDIR}/_ext/1519963337/utils.o.d ${OBJECTDIR}/_ext/1519963337/adc_processing.o.d ${OBJECTDIR}/_ext/1360937237/main.o.d ${OBJECTDIR}/_ext/1865161661/plib_dmac.o.d
 
 # Object Files
-OBJECTFILES=${OBJECTDIR}/_ext/60163342/plib_adc.o ${OBJECTDIR}/_ext/60167341/plib_eic.o ${OBJECTDIR}/_ext/1865468468/plib_nvic.o ${OBJECTDIR}/_ext/1865521619/plib_port.o ${OBJECTDIR}/_ext/508257091/plib_sercom1_i2c_master.o ${OBJECTDIR}/_ext/17022449/plib_sercom2_spi_master.o ${OBJECTDIR}/_ext/504274921/plib_sercom0_usart.o ${OBJECTDIR}/_ext/504274921/plib_sercom3_usart.o ${OBJECTDIR}/_ext/1827571544/plib_systick.o ${OBJECTDIR}/_ext/60181570/plib_tcc0.o ${OBJECTDIR}/_ext/60181570/plib_tcc1.o ${OBJECTDIR}/_ext/163028504/xc32_monitor.o ${OBJECTDIR}/_ext/1171490990/initialization.o ${OBJECTDIR}/_ext/1171490990/interrupts.o ${OBJECTDIR}/_ext/1171490990/exceptions.o ${OBJECTDIR}/_ext/1171490990/startup_xc32.o ${OBJECTDIR}/_ext/1171490990/libc_syscalls.o ${OBJECTDIR}/_ext/1536727238/i2c.o ${OBJECTDIR}/_ext/1536727238/spi.o ${OBJECTDIR}/_ext/1536727238/uart.o ${OBJECTDIR}/_ext/1536727238/systick.o ${OBJECTDIR}/_ext/1536727238/adc.o ${OBJECTDIR}/_ext/1536727238/pwm.o ${OBJECTDIR}/_ext/1639450193/ssd1362.o ${OBJECTDIR}/_ext/1639450193/sen6x.o ${OBJECTDIR}/_ext/1639450193/m95.o ${OBJECTDIR}/_ext/1639450193/buzzer.o ${OBJECTDIR}/_ext/1639450193/hid.o ${OBJECTDIR}/_ext/1639450193/led.o ${OBJECTDIR}/_ext/469845277/alert.o ${OBJECTDIR}/_ext/809997874/assets.o ${OBJECTDIR}/_ext/809997874/fonts.o ${OBJECTDIR}/_ext/809997874/widgets.o ${OBJECTDIR}/_ext/809997874/pages.o ${OBJECTDIR}/_ext/1519963337/utils.o ${OBJECTDIR}/_ext/1519963337/adc_processing.o ${OBJECTDIR}/_ext/1360937237/main.o ${OBJECTDIR}/_ext/1865161661/plib_dmac.o
+OBJECTFILES=${OBJECTDIR}/_ext/60163342/plib_adc.o ${OBJECTDIR}/_ext/60167341/plib_eic.o ${OBJECTDIR}/_ext/1865468468/plib_nvic.o ${OBJECTDIR}/_ext/1865521619/plib_port.o ${OBJECTDIR}/_ext/508257091/plib_sercom1_i2c_master.o ${OBJECTDIR}/_ext/17022449/plib_sercom2_spi_master.o ${OBJECTDIR}/_ext/504274921/plib_sercom0_usart.o ${OBJECTDIR}/_ext/504274921/plib_sercom3_usart.o ${OBJECTDIR}/_ext/1827571544/plib_systick.o ${OBJECTDIR}/_ext/60181570/plib_tcc0.o ${OBJECTDIR}/_ext/60181570/plib_tcc1.o ${OBJECTDIR}/_ext/163028504/xc32_monitor.o ${OBJECTDIR}/_ext/1171490990/initialization.o ${OBJECTDIR}/_ext/1171490990/interrupts.o ${OBJECTDIR}/_ext/1171490990/exceptions.o ${OBJECTDIR}/_ext/1171490990/startup_xc32.o ${OBJECTDIR}/_ext/1171490990/libc_syscalls.o ${OBJECTDIR}/_ext/1536727238/i2c.o ${OBJECTDIR}/_ext/1536727238/spi.o ${OBJECTDIR}/_ext/1536727238/uart.o ${OBJECTDIR}/_ext/1536727238/systick.o ${OBJECTDIR}/_ext/1536727238/adc.o ${OBJECTDIR}/_ext/1536727238/pwm.o ${OBJECTDIR}/_ext/1639450193/ssd1362.o ${OBJECTDIR}/_ext/1639450193/sen6x.o ${OBJECTDIR}/_ext/1639450193/m95.o ${OBJECTDIR}/_ext/1639450193/buzzer.o ${OBJECTDIR}/_ext/1639450193/hid.o ${OBJECTDIR}/_ext/1639450193/led.o ${OBJECTDIR}/_ext/469845277/alert.o ${OBJECTDIR}/_ext/469845277/history.o ${OBJECTDIR}/_ext/809997874/assets.o ${OBJECTDIR}/_ext/809997874/fonts.o ${OBJECTDIR}/_ext/809997874/widgets.o ${OBJECTDIR}/_ext/809997874/pages.o ${OBJECTDIR}/_ext/1519963337/utils.o ${OBJECTDIR}/_ext/1519963337/adc_processing.o ${OBJECTDIR}/_ext/1360937237/main.o ${OBJECTDIR}/_ext/1865161661/plib_dmac.o
 
 # Source Files
-SOURCEFILES=../src/config/default/peripheral/adc/plib_adc.c ../src/config/default/peripheral/eic/plib_eic.c ../src/config/default/peripheral/nvic/plib_nvic.c ../src/config/default/peripheral/port/plib_port.c ../src/config/default/peripheral/sercom/i2c_master/plib_sercom1_i2c_master.c ../src/config/default/peripheral/sercom/spi_master/plib_sercom2_spi_master.c ../src/config/default/peripheral/sercom/usart/plib_sercom0_usart.c ../src/config/default/peripheral/sercom/usart/plib_sercom3_usart.c ../src/config/default/peripheral/systick/plib_systick.c ../src/config/default/peripheral/tcc/plib_tcc0.c ../src/config/default/peripheral/tcc/plib_tcc1.c ../src/config/default/stdio/xc32_monitor.c ../src/config/default/initialization.c ../src/config/default/interrupts.c ../src/config/default/exceptions.c ../src/config/default/startup_xc32.c ../src/config/default/libc_syscalls.c ../src/cores/i2c.c ../src/cores/spi.c ../src/cores/uart.c ../src/cores/systick.c ../src/cores/adc.c ../src/cores/pwm.c ../src/drivers/ssd1362.c ../src/drivers/sen6x.c ../src/drivers/m95.c ../src/drivers/buzzer.c ../src/drivers/hid.c ../src/drivers/led.c ../src/processes/alert.c ../src/ui/assets.c ../src/ui/fonts.c ../src/ui/widgets.c ../src/ui/pages.c ../src/utils/utils.c ../src/utils/adc_processing.c ../src/main.c ../src/config/default/peripheral/dmac/plib_dmac.c
+SOURCEFILES=../src/config/default/peripheral/adc/plib_adc.c ../src/config/default/peripheral/eic/plib_eic.c ../src/config/default/peripheral/nvic/plib_nvic.c ../src/config/default/peripheral/port/plib_port.c ../src/config/default/peripheral/sercom/i2c_master/plib_sercom1_i2c_master.c ../src/config/default/peripheral/sercom/spi_master/plib_sercom2_spi_master.c ../src/config/default/peripheral/sercom/usart/plib_sercom0_usart.c ../src/config/default/peripheral/sercom/usart/plib_sercom3_usart.c ../src/config/default/peripheral/systick/plib_systick.c ../src/config/default/peripheral/tcc/plib_tcc0.c ../src/config/default/peripheral/tcc/plib_tcc1.c ../src/config/default/stdio/xc32_monitor.c ../src/config/default/initialization.c ../src/config/default/interrupts.c ../src/config/default/exceptions.c ../src/config/default/startup_xc32.c ../src/config/default/libc_syscalls.c ../src/cores/i2c.c ../src/cores/spi.c ../src/cores/uart.c ../src/cores/systick.c ../src/cores/adc.c ../src/cores/pwm.c ../src/drivers/ssd1362.c ../src/drivers/sen6x.c ../src/drivers/m95.c ../src/drivers/buzzer.c ../src/drivers/hid.c ../src/drivers/led.c ../src/processes/alert.c ../src/processes/history.c ../src/ui/assets.c ../src/ui/fonts.c ../src/ui/widgets.c ../src/ui/pages.c ../src/utils/utils.c ../src/utils/adc_processing.c ../src/main.c ../src/config/default/peripheral/dmac/plib_dmac.c
 
 # Pack Options 
 PACK_COMMON_OPTIONS=-I "${CMSIS_DIR}/CMSIS/Core/Include"
@@ -284,6 +284,12 @@ ${OBJECTDIR}/_ext/469845277/alert.o: ../src/processes/alert.c  .generated_files/
 	@${RM} ${OBJECTDIR}/_ext/469845277/alert.o 
 	${MP_CC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -fdata-sections -O2 -fno-common -I"../src" -I"../src/config/default" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core/Include" -I"../src/packs/PIC32CM5164LS00048_DFP" -MP -MMD -MF "${OBJECTDIR}/_ext/469845277/alert.o.d" -o ${OBJECTDIR}/_ext/469845277/alert.o ../src/processes/alert.c    -DXPRJ_default=$(CND_CONF)    $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}/PIC32CM-LS00" ${PACK_COMMON_OPTIONS} 
 	
+${OBJECTDIR}/_ext/469845277/history.o: ../src/processes/history.c  .generated_files/flags/default/f6aa6a64b924ca1bf9a9345de22d7f5ec895b51a .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
+	@${MKDIR} "${OBJECTDIR}/_ext/469845277" 
+	@${RM} ${OBJECTDIR}/_ext/469845277/history.o.d 
+	@${RM} ${OBJECTDIR}/_ext/469845277/history.o 
+	${MP_CC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -fdata-sections -O2 -fno-common -I"../src" -I"../src/config/default" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core/Include" -I"../src/packs/PIC32CM5164LS00048_DFP" -MP -MMD -MF "${OBJECTDIR}/_ext/469845277/history.o.d" -o ${OBJECTDIR}/_ext/469845277/history.o ../src/processes/history.c    -DXPRJ_default=$(CND_CONF)    $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}/PIC32CM-LS00" ${PACK_COMMON_OPTIONS} 
+	
 ${OBJECTDIR}/_ext/809997874/assets.o: ../src/ui/assets.c  .generated_files/flags/default/bb96bbdde4a3100d14a3a18372acb561cfb339a2 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/809997874" 
 	@${RM} ${OBJECTDIR}/_ext/809997874/assets.o.d 
@@ -513,6 +519,12 @@ ${OBJECTDIR}/_ext/469845277/alert.o: ../src/processes/alert.c  .generated_files/
 	@${RM} ${OBJECTDIR}/_ext/469845277/alert.o 
 	${MP_CC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -fdata-sections -O2 -fno-common -I"../src" -I"../src/config/default" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core/Include" -I"../src/packs/PIC32CM5164LS00048_DFP" -MP -MMD -MF "${OBJECTDIR}/_ext/469845277/alert.o.d" -o ${OBJECTDIR}/_ext/469845277/alert.o ../src/processes/alert.c    -DXPRJ_default=$(CND_CONF)    $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}/PIC32CM-LS00" ${PACK_COMMON_OPTIONS} 
 	
+${OBJECTDIR}/_ext/469845277/history.o: ../src/processes/history.c  .generated_files/flags/default/afbcae6af2b0e4cc2555dc3ea20014e84aca33ec .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
+	@${MKDIR} "${OBJECTDIR}/_ext/469845277" 
+	@${RM} ${OBJECTDIR}/_ext/469845277/history.o.d 
+	@${RM} ${OBJECTDIR}/_ext/469845277/history.o 
+	${MP_CC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -fdata-sections -O2 -fno-common -I"../src" -I"../src/config/default" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core/Include" -I"../src/packs/PIC32CM5164LS00048_DFP" -MP -MMD -MF "${OBJECTDIR}/_ext/469845277/history.o.d" -o ${OBJECTDIR}/_ext/469845277/history.o ../src/processes/history.c    -DXPRJ_default=$(CND_CONF)    $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}/PIC32CM-LS00" ${PACK_COMMON_OPTIONS} 
+	
 ${OBJECTDIR}/_ext/809997874/assets.o: ../src/ui/assets.c  .generated_files/flags/default/f6194c302746773f2048dd3bf8a1e6b1d8b305be .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/809997874" 
 	@${RM} ${OBJECTDIR}/_ext/809997874/assets.o.d 
@@ -65,6 +65,7 @@ void SysTick_Handler (void);
 void EIC_EXTINT_1_InterruptHandler (void);
 void EIC_EXTINT_2_InterruptHandler (void);
 void DMAC_0_InterruptHandler (void);
+void DMAC_1_InterruptHandler (void);
 void SERCOM0_USART_InterruptHandler (void);
 void SERCOM1_I2C_InterruptHandler (void);
 void SERCOM2_SPI_InterruptHandler (void);
@@ -53,7 +53,7 @@
 // *****************************************************************************
 // *****************************************************************************
 
-#define DMAC_CHANNELS_NUMBER        1U
+#define DMAC_CHANNELS_NUMBER        2U
 
 #define DMAC_CRC_CHANNEL_OFFSET     0x20U
 
@@ -123,6 +123,17 @@ void DMAC_Initialize( void )
     dmacChannelObj[0].inUse = 1U;
     DMAC_REGS->DMAC_CHINTENSET = (uint8_t)(DMAC_CHINTENSET_TERR_Msk | DMAC_CHINTENSET_TCMPL_Msk);
 
+    /***************** Configure DMA channel 1 ********************/
+
+    DMAC_REGS->DMAC_CHID = 1U;
+
+    DMAC_REGS->DMAC_CHCTRLB = DMAC_CHCTRLB_TRIGACT(2UL) | DMAC_CHCTRLB_TRIGSRC(41UL) | DMAC_CHCTRLB_LVL(0UL) ;
+
+    descriptor_section[1].DMAC_BTCTRL = (uint16_t)(DMAC_BTCTRL_BLOCKACT_INT | DMAC_BTCTRL_BEATSIZE_HWORD | DMAC_BTCTRL_VALID_Msk | DMAC_BTCTRL_DSTINC_Msk );
+
+    dmacChannelObj[1].inUse = 1U;
+    DMAC_REGS->DMAC_CHINTENSET = (uint8_t)(DMAC_CHINTENSET_TERR_Msk | DMAC_CHINTENSET_TCMPL_Msk);
+
     /* Enable the DMAC module & Priority Level x Enable */
     DMAC_REGS->DMAC_CTRL = (uint16_t)(DMAC_CTRL_DMAENABLE_Msk | DMAC_CTRL_LVLEN0_Msk | DMAC_CTRL_LVLEN1_Msk | DMAC_CTRL_LVLEN2_Msk | DMAC_CTRL_LVLEN3_Msk);
 }
@@ -510,11 +521,9 @@ uint32_t DMAC_CRCCalculate(void *buffer, uint32_t length, DMAC_CRC_SETUP CRCSetu
 /*******************************************************************************
     This function handles the DMA interrupt events.
 */
-void __attribute__((used)) DMAC_0_InterruptHandler( void )
+static void DMAC_channel_interruptHandler( uint8_t channel )
 {
     volatile DMAC_CH_OBJECT  *dmacChObj;
-    /* Get active channel number */
-    uint8_t channel = 0U;
     uint8_t channelId = 0U;
     volatile uint32_t chanIntFlagStatus = 0U;
     DMAC_TRANSFER_EVENT event = DMAC_TRANSFER_EVENT_ERROR;
@@ -564,4 +573,14 @@ void __attribute__((used)) DMAC_0_InterruptHandler( void )
     DMAC_REGS->DMAC_CHID = channelId;
 }
 
+void __attribute__((used)) DMAC_0_InterruptHandler( void )
+{
+    DMAC_channel_interruptHandler(0U);
+}
+
+void __attribute__((used)) DMAC_1_InterruptHandler( void )
+{
+    DMAC_channel_interruptHandler(1U);
+}
+
 
@@ -77,6 +77,7 @@ typedef enum
 {
     /* DMAC Channel 0 */
     DMAC_CHANNEL_0 = 0,
+    DMAC_CHANNEL_1 = 1,
 } DMAC_CHANNEL;
 
 typedef enum
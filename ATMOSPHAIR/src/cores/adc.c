@@ -3,43 +3,90 @@
 //* _ GLOBAL VARIABLE DECLARATIONS _____________________________________________
 
 volatile ADC_RAW_DATA_t ADC_data[ADC_CHANNEL_COUNT]; 
+volatile uint32_t       ADC_scan_sequence = 0; 
 
 
 //* _ STATIC VARIABLE DECLARATIONS _____________________________________________
 
 static volatile ADC_STATES_t    curr_state                = ADC_IDLE; 
-static volatile ADC_CHANNEL_t   selected_adc_channel_id   = ADC_HS2; 
-static uint32_t                 last_conversion_timestamp = 0; 
+static volatile ADC_GROUP_t     scan_group                = 0; 
+static volatile uint16_t        scan_buffer[ADC_CHANNEL_COUNT]; 
+static uint32_t                 ema_accumulators[ADC_CHANNEL_COUNT];   // Filtered data << ema_shift. 
+static uint32_t                 last_scan_timestamp       = 0; 
 
 
 //* _ STATIC FUNCTION DECLARATIONS _____________________________________________
 
 static void ADC_IDLE_state(void); 
-static void ADC_START_CHANNEL_CONVERSION_state(void); 
-static void ADC_WAIT_END_OF_CHANNEL_CONVERSION_state(void); 
-static void ADC_CONVERSION_DONE_state(void); 
-static void ADC_callback(ADC_STATUS status, uintptr_t context); 
+static void ADC_START_SCAN_state(void); 
+static void ADC_WAIT_END_OF_SCAN_state(void); 
+static void ADC_SCAN_DONE_state(void); 
+
+/// @fn static void ADC_callback(DMAC_TRANSFER_EVENT event, uintptr_t context); 
+/// @brief end of the transfer of one group results into scan_buffer 
+///        (interrupt context). It starts the next group, the last one of 
+///        the scan updates every channel at once. 
+static void ADC_callback(DMAC_TRANSFER_EVENT event, uintptr_t context); 
+
+/// @fn static void ADC_group_start(ADC_GROUP_t group); 
+/// @brief applies the settings of a group and starts its sequence. 
+static void ADC_group_start(ADC_GROUP_t group); 
+
+/// @fn static void ADC_scan_complete(void); 
+/// @brief filters the scan results into ADC_data and publishes the scan. 
+static void ADC_scan_complete(void); 
 
 
 //* _ LUT ______________________________________________________________________
 
-static const ADC_POSINPUT ADC_CHANNEL_FROM_ID_LUT[] = {
-    ADC_POSINPUT_AIN0,  ADC_POSINPUT_AIN1,  ADC_POSINPUT_AIN2,
-    ADC_POSINPUT_AIN3,  ADC_POSINPUT_AIN4,  ADC_POSINPUT_AIN5,
-    ADC_POSINPUT_AIN6,  ADC_POSINPUT_AIN7,  ADC_POSINPUT_AIN8,
-    ADC_POSINPUT_AIN9,  ADC_POSINPUT_AIN10, ADC_POSINPUT_AIN11,
-    ADC_POSINPUT_AIN18, ADC_POSINPUT_AIN19, ADC_POSINPUT_BANDGAP,
-    ADC_POSINPUT_SCALEDVDDCORE, ADC_POSINPUT_SCALEDAVDD,
-    ADC_POSINPUT_DAC0, ADC_POSINPUT_SCALEDVDD, 
-    ADC_POSINPUT_OPAMP01, ADC_POSINPUT_OPAMP2,
-};
+static const ADC_CHANNEL_CONFIG_t ADC_CHANNEL_CONFIG_LUT[ADC_CHANNEL_COUNT] = {
+    //                        input               ema_shift
+    [ADC_H2S]             = { ADC_POSINPUT_AIN0,  3 }, 
+    [ADC_O2]              = { ADC_POSINPUT_AIN1,  3 }, 
+    [ADC_CO]              = { ADC_POSINPUT_AIN2,  3 }, 
+    [ADC_FLAMMABLE_GASES] = { ADC_POSINPUT_AIN3,  3 }, 
+    [ADC_BATTERY_CHARGE]  = { ADC_POSINPUT_AIN4,  4 }, 
+}; 
+
+// The sum of 2^oversampling samples has 12 + oversampling bits, ADJRES 
+// shifts out the bits above the resolution. 
+static const ADC_GROUP_CONFIG_t ADC_GROUP_CONFIG_LUT[ADC_GROUP_COUNT] = {
+    #define X(group, first, last, oversampling, resolution, sample_length)                       \
+        [group] = { first, last,                                                                 \
+                    ADC_AVGCTRL_SAMPLENUM(oversampling)                                          \
+                    | ADC_AVGCTRL_ADJRES(ADC_NATIVE_RESOLUTION + (oversampling) - (resolution)), \
+                    sample_length }, 
+        ADC_GROUPS
+    #undef X
+}; 
+
+// Only 4^n samples carry n more bits, and the sum stays within 16 bits. 
+#define X(group, first, last, oversampling, resolution, sample_length)                                  \
+    _Static_assert((oversampling) <= ADC_OVERSAMPLING_MAX, #group " accumulates more than 16 samples"); \
+    _Static_assert((resolution) >= ADC_NATIVE_RESOLUTION                                                \
+                   && (resolution) <= ADC_NATIVE_RESOLUTION + (oversampling) / 2,                       \
+                   #group " resolution not reached by its samples");                                    \
+    _Static_assert((sample_length) <= 63, #group " sample length above SAMPCTRL.SAMPLEN");              \
+    _Static_assert((first) <= (last), #group " has no channel"); 
+    ADC_GROUPS
+#undef X
 
 
 void ADC_init(void)
 {
-    // Start the ADC peripheral and register the function callback. 
+    // The hardware accumulation needs the 16 bits result mode, the sum is 
+    // shifted to the resolution of the group by AVGCTRL.ADJRES. 
+    ADC_REGS->ADC_CTRLC = (ADC_REGS->ADC_CTRLC & (uint16_t)~ADC_CTRLC_RESSEL_Msk) | ADC_CTRLC_RESSEL_16BIT; 
+    while (ADC_REGS->ADC_SYNCBUSY & ADC_SYNCBUSY_CTRLC_Msk)
+        ; 
+    
+    // The results are moved by the DMAC on RESRDY, only the end of each 
+    // group interrupts the CPU. 
+    ADC_InterruptsDisable(ADC_STATUS_RESRDY); 
+    DMAC_ChannelCallbackRegister(DMAC_CHANNEL_1, ADC_callback, (uintptr_t)NULL); 
+    
+    // Start the ADC peripheral. 
     ADC_Enable(); 
-    ADC_CallbackRegister(ADC_callback, (uintptr_t)NULL); 
     return; 
 }
 
@@ -52,19 +99,19 @@ void ADC_task(void)
             ADC_IDLE_state(); 
             break; 
         
-        case ADC_START_CHANNEL_CONVERSION: 
-            ADC_START_CHANNEL_CONVERSION_state(); 
+        case ADC_START_SCAN: 
+            ADC_START_SCAN_state(); 
             break; 
-            
-        case ADC_WAIT_END_OF_CHANNEL_CONVERSION: 
-            ADC_WAIT_END_OF_CHANNEL_CONVERSION_state(); 
+        
+        case ADC_WAIT_END_OF_SCAN: 
+            ADC_WAIT_END_OF_SCAN_state(); 
             break; 
         
-        case ADC_CONVERSION_DONE: 
-            ADC_CONVERSION_DONE_state(); 
+        case ADC_SCAN_DONE: 
+            ADC_SCAN_DONE_state(); 
             break; 
-            
-        default:
+        
+        default: 
             curr_state = ADC_IDLE; 
             break; 
     }
@@ -73,31 +120,22 @@ void ADC_task(void)
 }
 
 
-static void ADC_callback(ADC_STATUS status, uintptr_t context) 
+static void ADC_callback(DMAC_TRANSFER_EVENT event, uintptr_t context)
 {
-    uint16_t adc_result; 
-    uint16_t last_filtered_data; 
+    // Transfer of an aborted scan. On an error the scan is left to the 
+    // timeout, which restarts it from the first group. 
+    if (curr_state != ADC_WAIT_END_OF_SCAN || event != DMAC_TRANSFER_EVENT_COMPLETE)
+        return; 
     
-    // ADC channel select index error, reset the whole machine state. 
-    if (selected_adc_channel_id >= ADC_CHANNEL_COUNT)
+    scan_group += 1; 
+    if (scan_group < ADC_GROUP_COUNT)
     {
-        curr_state = ADC_IDLE; 
+        ADC_group_start(scan_group); 
         return; 
     }
     
-    // Get the newly converted data from the ADC and mark it has new value. 
-    adc_result = ADC_ConversionResultGet(); 
-    last_filtered_data = ADC_data[selected_adc_channel_id].ema_filtered_data; 
-    
-    ADC_data[selected_adc_channel_id].ema_filtered_data = last_filtered_data \
-            + ((adc_result - last_filtered_data) >> 3); 
-    ADC_data[selected_adc_channel_id].data = adc_result; 
-    ADC_data[selected_adc_channel_id].data_is_new = true;
-    
-    // Increment the channel selection and go to the START_CHANNEL_CONVERSION 
-    // state. 
-    selected_adc_channel_id += 1; 
-    curr_state = ADC_START_CHANNEL_CONVERSION; 
+    ADC_scan_complete(); 
+    curr_state = ADC_SCAN_DONE; 
     return; 
 }
 
@@ -106,56 +144,100 @@ static void ADC_callback(ADC_STATUS status, uintptr_t context)
 
 static void ADC_IDLE_state(void)
 {
-    selected_adc_channel_id = 0; 
-    curr_state = ADC_START_CHANNEL_CONVERSION; 
+    scan_group = 0; 
+    curr_state = ADC_START_SCAN; 
     return; 
 }
 
 
-static void ADC_START_CHANNEL_CONVERSION_state(void)
-{    
-    // Go to the next state when all ADC conversion are done. 
-    if (selected_adc_channel_id >= ADC_CHANNEL_COUNT)
-    {
-        last_conversion_timestamp = SYSTICK_millis(); 
-        curr_state = ADC_CONVERSION_DONE; 
+static void ADC_START_SCAN_state(void)
+{
+    // The state is set first, the results of a fast scan can come before the
+    // start function returns. 
+    last_scan_timestamp = SYSTICK_millis(); 
+    curr_state = ADC_WAIT_END_OF_SCAN; 
+    ADC_group_start(0); 
+    return; 
+}
+
+
+static void ADC_WAIT_END_OF_SCAN_state(void)
+{
+    if (SYSTICK_millis() - last_scan_timestamp <= SCAN_TIMEOUT_MS)
         return; 
-    }
     
-    // Select the ADC channel and start the conversion. 
-    ADC_ChannelSelect(
-            ADC_CHANNEL_FROM_ID_LUT[selected_adc_channel_id], 
-            ADC_NEGINPUT_AVSS
-    );
-    
-    ADC_ConversionStart();
-    
-    // Save the timestamp of the last conversion request and go to the next 
-    // state. 
-    last_conversion_timestamp = SYSTICK_millis(); 
-    curr_state = ADC_WAIT_END_OF_CHANNEL_CONVERSION; 
+    // A result was lost, the transfer and the sequence in progress are 
+    // dropped and the next scan starts over from the first group. 
+    DMAC_ChannelDisable(DMAC_CHANNEL_1); 
+    ADC_REGS->ADC_SWTRIG = ADC_SWTRIG_FLUSH_Msk; 
+    curr_state = ADC_IDLE; 
     return; 
 }
 
 
-static void ADC_WAIT_END_OF_CHANNEL_CONVERSION_state(void)
+static void ADC_SCAN_DONE_state(void)
 {
-    if (SYSTICK_millis() - last_conversion_timestamp <= CONVERSION_TIMEOUT_MS)
+    if (SYSTICK_millis() - last_scan_timestamp <= WAIT_BETWEEN_CYCLE_MS)
         return; 
     
-    curr_state = ADC_IDLE;
+    curr_state = ADC_IDLE; 
     return; 
 }
 
 
-static void ADC_CONVERSION_DONE_state(void)
+static void ADC_group_start(ADC_GROUP_t group)
 {
-    if (SYSTICK_millis() - last_conversion_timestamp <= WAIT_BETWEEN_CYCLE_MS)
-        return; 
+    const ADC_GROUP_CONFIG_t* config   = &ADC_GROUP_CONFIG_LUT[group]; 
+    uint32_t                  sequence = 0; 
+    uint32_t                  i; 
     
-    // Process each channel ADC conversion. 
+    ADC_REGS->ADC_AVGCTRL  = config->avgctrl; 
+    ADC_REGS->ADC_SAMPCTRL = ADC_SAMPCTRL_SAMPLEN(config->sample_length); 
+    while (ADC_REGS->ADC_SYNCBUSY & (ADC_SYNCBUSY_AVGCTRL_Msk | ADC_SYNCBUSY_SAMPCTRL_Msk))
+        ; 
     
-    curr_state = ADC_IDLE; 
+    // The sequencer converts the enabled inputs in ascending order, one 
+    // start trigger runs the whole group. 
+    for (i = config->first; i <= config->last; i += 1)
+        sequence |= 1UL << ((ADC_CHANNEL_CONFIG_LUT[i].input & ADC_INPUTCTRL_MUXPOS_Msk) >> ADC_INPUTCTRL_MUXPOS_Pos); 
+    
+    ADC_ChannelSelect(ADC_CHANNEL_CONFIG_LUT[config->first].input, ADC_NEGINPUT_AVSS); 
+    ADC_REGS->ADC_SEQCTRL = ADC_SEQCTRL_SEQEN(sequence); 
+    
+    // Each RESRDY moves one result to the slot of its channel, the channels 
+    // of a group are consecutive in scan_buffer. 
+    DMAC_ChannelTransfer(
+        DMAC_CHANNEL_1, 
+        (const void*)&ADC_REGS->ADC_RESULT, 
+        (const void*)&scan_buffer[config->first], 
+        (config->last - config->first + 1) * sizeof(scan_buffer[0])
+    ); 
+    ADC_ConversionStart(); 
+    return; 
+}
+
+
+static void ADC_scan_complete(void)
+{
+    uint8_t  shift; 
+    uint32_t i; 
+    
+    // Fixed-point EMA, the accumulator keeps the fraction bits the filtered 
+    // data would lose. It starts from the first result instead of 0. 
+    for (i = 0; i < ADC_CHANNEL_COUNT; i += 1)
+    {
+        shift = ADC_CHANNEL_CONFIG_LUT[i].ema_shift; 
+        if (ADC_scan_sequence == 0)
+            ema_accumulators[i] = (uint32_t)scan_buffer[i] << shift; 
+        else
+            ema_accumulators[i] += scan_buffer[i] - (ema_accumulators[i] >> shift); 
+    
+        ADC_data[i].ema_filtered_data = ema_accumulators[i] >> shift; 
+        ADC_data[i].data = scan_buffer[i]; 
+        ADC_data[i].data_is_new = true; 
+    }
+    
+    ADC_scan_sequence += 1; 
     return; 
 }
 
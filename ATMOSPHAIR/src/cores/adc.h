@@ -10,10 +10,32 @@
 
 //* _ DEFINITIONS ______________________________________________________________
 
-#define CONVERSION_TIMEOUT_MS   10
+// A channel averaging 16 long samples takes up to about 20 ms at the slowest
+// ADC clock. 
+#define CONVERSION_TIMEOUT_MS   50
 #define WAIT_BETWEEN_CYCLE_MS   500
-
-#define EMA_ALPHA_FACTOR        0.5
+#define SCAN_TIMEOUT_MS         (CONVERSION_TIMEOUT_MS * ADC_CHANNEL_COUNT)
+
+// Accumulating 4^n samples adds n bits to the 12 bits of a conversion. Above 
+// 16 samples the hardware shifts the sum to fit 16 bits on its own. 
+#define ADC_NATIVE_RESOLUTION   12
+#define ADC_OVERSAMPLING_MAX    4
+
+// Resolution of ADC_data for each group of channels. 
+#define ADC_GAS_RESOLUTION      14
+#define ADC_BATTERY_RESOLUTION  12
+
+// Each group is converted as one hardware sequence with the same settings, 
+// in the order of the list: 
+// - first, last: its channels, their inputs in ascending order. 
+// - oversampling: log2 of the samples accumulated, up to ADC_OVERSAMPLING_MAX. 
+// - resolution: bits kept from the sum, AVGCTRL.ADJRES drops the others. 
+// - sample_length: sampling time in half ADC clock cycles minus 1, up to 63. 
+// The gas sensors have low signals on high impedance outputs: longer sampling 
+// and 16 samples for 2 more bits. The battery voltage only needs to be smoothed. 
+//                        group               first                last                  oversampling  resolution              sample_length
+#define ADC_GROUPS      X(ADC_GROUP_GAS,      ADC_H2S,             ADC_FLAMMABLE_GASES,  4,            ADC_GAS_RESOLUTION,     15)  \
+                        X(ADC_GROUP_BATTERY,  ADC_BATTERY_CHARGE,  ADC_BATTERY_CHARGE,   2,            ADC_BATTERY_RESOLUTION, 3)
 
 
 //* _ ENUMERATIONS _____________________________________________________________
@@ -21,15 +43,18 @@
 typedef enum adc_states
 {
     ADC_IDLE, 
-    ADC_START_CHANNEL_CONVERSION,
-    ADC_WAIT_END_OF_CHANNEL_CONVERSION,
-    ADC_CONVERSION_DONE,         
+    ADC_START_SCAN,
+    ADC_WAIT_END_OF_SCAN,   ///< The DMAC collects the results, its interrupt starts the next group. 
+    ADC_SCAN_DONE,         
 }   ADC_STATES_t;
 
 
+/// @enum ADC_CHANNEL_t
+/// @brief analog channels, converted in this order by each scan. The 
+///        channels of a group of ADC_GROUPS follow each other. 
 typedef enum adc_channel
 {
-    ADC_HS2, 
+    ADC_H2S, 
     ADC_O2,
     ADC_CO,
     ADC_FLAMMABLE_GASES,         
@@ -38,6 +63,15 @@ typedef enum adc_channel
 }   ADC_CHANNEL_t;
 
 
+typedef enum adc_group
+{
+    #define X(group, first, last, oversampling, resolution, sample_length)  group, 
+        ADC_GROUPS
+    #undef X
+    ADC_GROUP_COUNT, 
+}   ADC_GROUP_t;
+
+
 //* _ STRUCTURE DEFINITIONS ____________________________________________________
 
 typedef struct adc_raw_data
@@ -48,9 +82,31 @@ typedef struct adc_raw_data
 }   ADC_RAW_DATA_t;
 
 
+/// @struct ADC_CHANNEL_CONFIG_t
+/// @brief input and filtering of one channel. 
+typedef struct adc_channel_config
+{
+    ADC_POSINPUT    input; 
+    uint8_t         ema_shift;          ///< EMA filter coefficient, alpha = 1 / 2^ema_shift. 
+}   ADC_CHANNEL_CONFIG_t;
+
+
+/// @struct ADC_GROUP_CONFIG_t
+/// @brief conversion settings of one group, applied by the interrupt before 
+///        its sequence is started. 
+typedef struct adc_group_config
+{
+    ADC_CHANNEL_t   first; 
+    ADC_CHANNEL_t   last; 
+    uint8_t         avgctrl;            /// AVGCTRL value, samples accumulated and result shift. 
+    uint8_t         sample_length;      ///< SAMPCTRL.SAMPLEN value. 
+}   ADC_GROUP_CONFIG_t;
+
+
 //* _ EXTERN VARIABLE DECLARATIONS _____________________________________________
 
 extern volatile ADC_RAW_DATA_t ADC_data[ADC_CHANNEL_COUNT]; 
+extern volatile uint32_t       ADC_scan_sequence;   ///< Incremented once each scan is complete. 
 
 
 //* _ FUNCTION DECLARATIONS ____________________________________________________
@@ -61,7 +117,8 @@ void ADC_init(void);
 
 
 /// @fn void ADC_task(void); 
-/// @brief maintains the ADC peripheral state machine. 
+/// @brief maintains the ADC peripheral state machine, starts one scan of 
+///        every channel each WAIT_BETWEEN_CYCLE_MS. 
 void ADC_task(void); 
 
 #endif
@@ -1 +1,317 @@
-#include "i2c.h"
\ No newline at end of file
+#include "i2c.h"
+
+
+//* _ STATIC VARIABLE DECLARATIONS _____________________________________________
+
+static const I2C_PLIB_t*        plib            = &I2C_SERCOM1_PLIB; 
+
+// Circular queue of pending transactions, the head one is being executed. 
+static I2C_TRANSACTION_t        queue[I2C_QUEUE_LENGTH]; 
+static uint32_t                 queue_head      = 0; 
+static uint32_t                 queue_count     = 0; 
+
+static volatile I2C_STATES_t    curr_state      = I2C_IDLE; 
+static volatile uint32_t        done_timestamp  = 0; 
+static volatile I2C_RESULT_t    result          = I2C_SUCCESS; 
+static uint32_t                 state_timestamp = 0; 
+static volatile bool            is_read_pending = false; 
+
+
+//* _ STATIC FUNCTION DECLARATIONS _____________________________________________
+
+/// @fn static void I2C_transfer_callback(uintptr_t context); 
+/// @brief end of plib transfer (interrupt context), saves the result for the 
+///        task. A write directly followed by its read is chained here. 
+/// @param context not used. 
+static void I2C_transfer_callback(uintptr_t context); 
+
+/// @fn static bool I2C_start(I2C_TRANSACTION_t* transaction); 
+/// @brief starts the first transfer of a transaction. 
+/// @return false if the plib refused the transfer. 
+static bool I2C_start(I2C_TRANSACTION_t* transaction); 
+
+/// @fn static void I2C_complete(I2C_RESULT_t status); 
+/// @brief removes the head transaction from the queue and notifies it. 
+static void I2C_complete(I2C_RESULT_t status); 
+
+/// @fn static I2C_RESULT_t I2C_plib_result(void); 
+/// @brief translates the error of the last plib transfer. 
+static I2C_RESULT_t I2C_plib_result(void); 
+
+/// @fn static void I2C_SERCOM1_bus_recover(void); 
+/// @brief clocks SCL until the device holding SDA low lets go, then sends 
+///        a stop condition. The pins are given back to the SERCOM. 
+static void I2C_SERCOM1_bus_recover(void); 
+
+/// @fn static void I2C_delay_us(uint32_t delay_us); 
+/// @brief busy wait, only used to bit-bang the bus recovery. 
+static void I2C_delay_us(uint32_t delay_us); 
+
+
+//* _ GLOBAL VARIABLE DECLARATIONS _____________________________________________
+
+const I2C_PLIB_t I2C_SERCOM1_PLIB = {
+    .initialize         = SERCOM1_I2C_Initialize, 
+    .read               = SERCOM1_I2C_Read, 
+    .write              = SERCOM1_I2C_Write, 
+    .is_busy            = SERCOM1_I2C_IsBusy, 
+    .error_get          = SERCOM1_I2C_ErrorGet, 
+    .transfer_abort     = SERCOM1_I2C_TransferAbort, 
+    .callback_register  = SERCOM1_I2C_CallbackRegister, 
+    .task               = NULL, 
+    .bus_recover        = I2C_SERCOM1_bus_recover, 
+}; 
+
+
+//* _ FUNCTION IMPLEMENTATION __________________________________________________
+
+void I2C_init(const I2C_PLIB_t* bus)
+{
+    plib = bus; 
+    plib->callback_register(I2C_transfer_callback, (uintptr_t)NULL); 
+    return; 
+}
+
+
+bool I2C_submit(const I2C_TRANSACTION_t* transaction)
+{
+    if (queue_count >= I2C_QUEUE_LENGTH)
+        return false; 
+    
+    if (transaction->type != I2C_READ && transaction->tx_length > I2C_TX_MAX_LENGTH)
+        return false; 
+    
+    if (transaction->type != I2C_WRITE && !transaction->rx_data)
+        return false; 
+    
+    // The bus busy time of a new head transaction starts now. 
+    if (queue_count == 0)
+        state_timestamp = SYSTICK_millis(); 
+    
+    queue[(queue_head + queue_count) % I2C_QUEUE_LENGTH] = *transaction; 
+    queue_count += 1; 
+    return true; 
+}
+
+
+bool I2C_is_idle(void)
+{
+    return queue_count == 0; 
+}
+
+
+void I2C_bus_recover(void)
+{
+    // An emulated bus has no pins to drive, it is only restarted. 
+    if (plib->bus_recover)
+        plib->bus_recover(); 
+    
+    plib->initialize(); 
+    
+    state_timestamp = SYSTICK_millis(); 
+    curr_state      = I2C_IDLE; 
+    return; 
+}
+
+
+void I2C_task(void)
+{
+    I2C_TRANSACTION_t* transaction; 
+    
+    // A simulated device completes its transfers from here. 
+    if (plib->task)
+        plib->task(); 
+    
+    if (queue_count == 0)
+        return; 
+    
+    transaction = &queue[queue_head]; 
+    
+    switch (curr_state)
+    {
+        case I2C_IDLE:
+            // The bus can still be used by a blocking transfer, or be held 
+            // by a stuck device. 
+            if (plib->is_busy())
+            {
+                if (SYSTICK_millis() - state_timestamp >= I2C_TIMEOUT_MS)
+                    I2C_complete(I2C_ERROR_TIMEOUT); 
+                break; 
+            }
+    
+            if (!I2C_start(transaction))
+                I2C_complete(I2C_ERROR_BUS); 
+            break; 
+    
+        case I2C_TRANSFER:
+            // Waiting for the plib callback, a device stretching the clock 
+            // forever never lets it come. 
+            if (SYSTICK_millis() - state_timestamp < I2C_TIMEOUT_MS)
+                break; 
+    
+            curr_state = I2C_IDLE; 
+            plib->transfer_abort(); 
+            I2C_complete(I2C_ERROR_TIMEOUT); 
+            break; 
+    
+        case I2C_TRANSFER_DONE:
+            if (result != I2C_SUCCESS)
+            {
+                I2C_complete(result); 
+                break; 
+            }
+    
+            // Let the device execute the command before reading its answer 
+            // or releasing the bus for the next command. 
+            if (SYSTICK_millis() - done_timestamp < transaction->delay_ms)
+                break; 
+    
+            if (!is_read_pending)
+            {
+                I2C_complete(I2C_SUCCESS); 
+                break; 
+            }
+    
+            is_read_pending = false; 
+            state_timestamp = SYSTICK_millis(); 
+            curr_state      = I2C_TRANSFER; 
+            if (!plib->read(transaction->addr, transaction->rx_data, transaction->rx_length))
+                I2C_complete(I2C_ERROR_BUS); 
+            break; 
+    
+        default:
+            curr_state = I2C_IDLE; 
+            break; 
+    }
+    
+    return; 
+}
+
+
+//* _ STATIC FUNCTION IMPLEMENTATION ___________________________________________
+
+static void I2C_transfer_callback(uintptr_t context)
+{
+    I2C_TRANSACTION_t* transaction; 
+    
+    // Transfers started outside of the engine are ignored. 
+    if (curr_state != I2C_TRANSFER)
+        return; 
+    
+    transaction = &queue[queue_head]; 
+    result      = I2C_plib_result(); 
+    
+    // No execution time, the read is started right away. 
+    if (result == I2C_SUCCESS && is_read_pending && transaction->delay_ms == 0)
+    {
+        is_read_pending = false; 
+        if (plib->read(transaction->addr, transaction->rx_data, transaction->rx_length))
+            return; 
+    
+        result = I2C_ERROR_BUS; 
+    }
+    
+    done_timestamp = SYSTICK_millis(); 
+    curr_state     = I2C_TRANSFER_DONE; 
+    return; 
+}
+
+
+static bool I2C_start(I2C_TRANSACTION_t* transaction)
+{
+    result          = I2C_SUCCESS; 
+    is_read_pending = transaction->type == I2C_WRITE_READ; 
+    state_timestamp = SYSTICK_millis(); 
+    curr_state      = I2C_TRANSFER; 
+    
+    if (transaction->type == I2C_READ)
+        return plib->read(transaction->addr, transaction->rx_data, transaction->rx_length); 
+    
+    return plib->write(transaction->addr, transaction->tx_data, transaction->tx_length); 
+}
+
+
+static void I2C_complete(I2C_RESULT_t status)
+{
+    I2C_TRANSACTION_t transaction; 
+    
+    // The transaction leaves the queue before its callback so it can submit 
+    // the next one. 
+    transaction     = queue[queue_head]; 
+    queue_head      = (queue_head + 1) % I2C_QUEUE_LENGTH; 
+    queue_count    -= 1; 
+    is_read_pending = false; 
+    state_timestamp = SYSTICK_millis(); 
+    curr_state      = I2C_IDLE; 
+    
+    if (transaction.callback)
+        transaction.callback(status, transaction.context); 
+    
+    return; 
+}
+
+
+static I2C_RESULT_t I2C_plib_result(void)
+{
+    switch (plib->error_get())
+    {
+        case SERCOM_I2C_ERROR_NONE: 
+            return I2C_SUCCESS; 
+    
+        case SERCOM_I2C_ERROR_NAK: 
+            return I2C_ERROR_NAK; 
+    
+        default: 
+            return I2C_ERROR_BUS; 
+    }
+}
+
+
+static void I2C_SERCOM1_bus_recover(void)
+{
+    uint32_t i; 
+    
+    // Take both pins from the SERCOM and drive them as open drain: output 
+    // low, or input to let the pull-ups release the line. 
+    PORT_REGS->GROUP[0].PORT_PINCFG[I2C_SDA_PIN] = PORT_PINCFG_INEN_Msk; 
+    PORT_REGS->GROUP[0].PORT_PINCFG[I2C_SCL_PIN] = PORT_PINCFG_INEN_Msk; 
+    PORT_PinClear(I2C_SDA_PIN); 
+    PORT_PinClear(I2C_SCL_PIN); 
+    PORT_PinInputEnable(I2C_SDA_PIN); 
+    PORT_PinInputEnable(I2C_SCL_PIN); 
+    I2C_delay_us(I2C_RECOVERY_HALF_US); 
+    
+    // A device interrupted in the middle of a byte holds SDA low, clock the 
+    // rest of it out until SDA is released. 
+    for (i = 0; i < I2C_RECOVERY_CLOCKS && !PORT_PinRead(I2C_SDA_PIN); i += 1)
+    {
+        PORT_PinOutputEnable(I2C_SCL_PIN); 
+        I2C_delay_us(I2C_RECOVERY_HALF_US); 
+        PORT_PinInputEnable(I2C_SCL_PIN); 
+        I2C_delay_us(I2C_RECOVERY_HALF_US); 
+    }
+    
+    // Start then stop condition while SCL is high, every device goes back 
+    // to waiting for its address. 
+    PORT_PinOutputEnable(I2C_SDA_PIN); 
+    I2C_delay_us(I2C_RECOVERY_HALF_US); 
+    PORT_PinInputEnable(I2C_SDA_PIN); 
+    I2C_delay_us(I2C_RECOVERY_HALF_US); 
+    
+    // Give the pins back to the SERCOM. 
+    PORT_REGS->GROUP[0].PORT_PINCFG[I2C_SDA_PIN] = PORT_PINCFG_PMUXEN_Msk; 
+    PORT_REGS->GROUP[0].PORT_PINCFG[I2C_SCL_PIN] = PORT_PINCFG_PMUXEN_Msk; 
+    return; 
+}
+
+
+static void I2C_delay_us(uint32_t delay_us)
+{
+    uint32_t start_time; 
+    
+    start_time = SYSTICK_micros(); 
+    while (SYSTICK_micros() - start_time < delay_us)
+        ; 
+    
+    return; 
+}
@@ -0,0 +1,136 @@
+#ifndef _I2C_H_
+#define _I2C_H_
+
+//* _ INCLUDES _________________________________________________________________
+#include <stdlib.h>
+#include "definitions.h"
+
+#include "../cores/systick.h"
+
+
+//* _ DEFINITIONS ______________________________________________________________
+
+#define I2C_QUEUE_LENGTH        8
+#define I2C_TX_MAX_LENGTH       14          // SEN6x command with 4 argument words.
+
+// A transfer, or the bus staying busy before it, longer than this means a 
+// device holds SCL or SDA low. 
+#define I2C_TIMEOUT_MS          50
+
+// Bus recovery, SERCOM1 PAD0 (SDA) and PAD1 (SCL) are on port group A. 
+#define I2C_SDA_PIN             PORT_PIN_PA08
+#define I2C_SCL_PIN             PORT_PIN_PA09
+#define I2C_RECOVERY_CLOCKS     9           // A byte and its acknowledge.
+#define I2C_RECOVERY_HALF_US    5           // 100 kHz clock.
+
+
+//* _ ENUMERATIONS _____________________________________________________________
+
+/// @enum I2C_TRANSFER_t 
+/// @brief enumerate the kind of transactions handled by the I²C engine. 
+typedef enum i2c_transfer
+{
+    I2C_WRITE,
+    I2C_READ,
+    I2C_WRITE_READ,         ///< Write, wait for delay_ms then read.
+}   I2C_TRANSFER_t; 
+
+
+/// @enum I2C_RESULT_t 
+/// @brief outcome of a transaction, given to its callback. 
+typedef enum i2c_result
+{
+    I2C_SUCCESS, 
+    I2C_ERROR_NAK,          ///< The device didn't acknowledge its address or a byte.
+    I2C_ERROR_BUS,          ///< Bus error, lost arbitration or transfer refused by the plib.
+    I2C_ERROR_TIMEOUT,      ///< The transfer didn't end within I2C_TIMEOUT_MS.
+}   I2C_RESULT_t; 
+
+
+typedef enum i2c_states
+{
+    I2C_IDLE,
+    I2C_TRANSFER,           ///< The plib is sending or receiving bytes.
+    I2C_TRANSFER_DONE,      ///< The plib callback fired, waiting for the delay.
+}   I2C_STATES_t; 
+
+
+//* _ STRUCTURE DEFINITIONS ____________________________________________________
+
+/// @typedef I2C_CALLBACK_t 
+/// @brief called once the transaction is over, from the main loop context. 
+/// @param result I2C_SUCCESS or the cause of the failure. 
+/// @param context value given with the transaction. 
+typedef void (*I2C_CALLBACK_t)(I2C_RESULT_t result, uintptr_t context); 
+
+
+/// @struct I2C_PLIB_t 
+/// @brief bus used by the engine, the SERCOM1 plib or an emulated bus with 
+///        the same interface. 
+typedef struct i2c_plib
+{
+    void                (*initialize)(void); 
+    bool                (*read)(uint16_t address, uint8_t* data, uint32_t length); 
+    bool                (*write)(uint16_t address, uint8_t* data, uint32_t length); 
+    bool                (*is_busy)(void); 
+    SERCOM_I2C_ERROR    (*error_get)(void); 
+    void                (*transfer_abort)(void); 
+    void                (*callback_register)(SERCOM_I2C_CALLBACK callback, uintptr_t context); 
+    void                (*task)(void);          ///< Polled by I2C_task, can be NULL. 
+    void                (*bus_recover)(void);   ///< Releases SDA by driving the pins, NULL if the bus has no pins. 
+}   I2C_PLIB_t; 
+
+
+typedef struct i2c_transaction
+{
+    uint8_t         addr;                           ///< 7 bits address of the device.
+    I2C_TRANSFER_t  type; 
+    uint8_t         tx_data[I2C_TX_MAX_LENGTH];     ///< Bytes to write, copied on submit.
+    uint8_t         tx_length; 
+    uint8_t*        rx_data;                        ///< Buffer filled by the read, owned by the caller.
+    uint8_t         rx_length; 
+    uint16_t        delay_ms;                       ///< Execution time of the command, waited before the read or before completing a write.
+    I2C_CALLBACK_t  callback;                       ///< Can be NULL.
+    uintptr_t       context; 
+}   I2C_TRANSACTION_t; 
+
+
+//* _ EXTERN VARIABLE DECLARATIONS _____________________________________________
+
+extern const I2C_PLIB_t I2C_SERCOM1_PLIB; 
+
+
+//* _ FUNCTION DECLARATIONS ____________________________________________________
+
+/// @fn void I2C_init(const I2C_PLIB_t* bus); 
+/// @brief selects the bus of the engine and registers its completion 
+///        callback. 
+/// @param bus I2C_SERCOM1_PLIB, or an emulated bus. 
+void I2C_init(const I2C_PLIB_t* bus); 
+
+
+/// @fn bool I2C_submit(const I2C_TRANSACTION_t* transaction); 
+/// @brief queues a transaction, transactions are executed in submit order. 
+/// @param transaction transaction to copy in the queue. 
+/// @return false if the queue is full or the transaction is invalid. 
+bool I2C_submit(const I2C_TRANSACTION_t* transaction); 
+
+
+/// @fn bool I2C_is_idle(void); 
+/// @brief tells if every queued transaction has completed. 
+bool I2C_is_idle(void); 
+
+
+/// @fn void I2C_bus_recover(void); 
+/// @brief releases a device holding SDA low with the bus_recover function 
+///        of the plib and re-initializes the bus. Blocks for about 100 us on 
+///        SERCOM1, only call it while the engine is idle. 
+void I2C_bus_recover(void); 
+
+
+/// @fn void I2C_task(void); 
+/// @brief starts the queued transactions, waits their delay without blocking 
+///        and notifies their callback. 
+void I2C_task(void); 
+
+#endif
@@ -31,6 +31,22 @@ uint32_t SYSTICK_millis(void)
 }
 
 
+uint32_t SYSTICK_micros(void)
+{
+    uint32_t ms; 
+    uint32_t ticks; 
+    
+    // Read the counter again if the millisecond counter overflowed in between. 
+    do
+    {
+        ms    = systick_ms_counter; 
+        ticks = SYSTICK_TimerPeriodGet() - SYSTICK_TimerCounterGet(); 
+    }   while (ms != systick_ms_counter); 
+    
+    return ms * 1000 + ticks / (SYSTICK_TimerFrequencyGet() / 1000000); 
+}
+
+
 //* _ STATIC FUNCTION IMPLEMENTATION ___________________________________________
 
 static void systick_overflow_callback(uintptr_t context)
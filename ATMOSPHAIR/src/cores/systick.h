@@ -19,4 +19,11 @@ void SYSTICK_init(void);
 /// @return the millisecond counter value. 
 uint32_t SYSTICK_millis(void); 
 
+
+/// @fn uint32_t SYSTICK_micros(void); 
+/// @brief Getter for the running time in microsecond, uses the current 
+///        systick timer value for sub-millisecond resolution. 
+/// @return the microsecond counter value. 
+uint32_t SYSTICK_micros(void); 
+
 #endif
\ No newline at end of file
@@ -1 +1,32 @@
 #include "uart.h"
+
+
+//* _ FUNCTION IMPLEMENTATION __________________________________________________
+
+void UART_debug_write(const void* data, size_t size)
+{
+    SERCOM3_USART_Write((void*)data, size); 
+    return; 
+}
+
+
+void UART_debug_printf(const char* format, ...)
+{
+    char    buffer[DEBUG_PRINTF_BUFFER_SIZE]; 
+    int     len; 
+    va_list args; 
+    
+    va_start(args, format); 
+    len = vsnprintf(buffer, sizeof(buffer), format, args); 
+    va_end(args); 
+    
+    if (len < 0)
+        return; 
+    
+    // Truncated strings are sent up to the end of the buffer. 
+    if ((size_t)len >= sizeof(buffer))
+        len = sizeof(buffer) - 1; 
+    
+    UART_debug_write(buffer, len); 
+    return; 
+}
@@ -1,6 +1,33 @@
 #ifndef _UART_H_
 #define _UART_H_
 
+//* _ INCLUDES _________________________________________________________________
 
+#include <stdlib.h>
+#include "definitions.h" 
 
-#endif
\ No newline at end of file
+#include <stdarg.h>
+#include <stdio.h>
+
+
+//* _ DEFINITIONS ______________________________________________________________
+
+#define DEBUG_PRINTF_BUFFER_SIZE    128
+
+
+//* _ FUNCTION DECLARATIONS ____________________________________________________
+
+/// @fn void UART_debug_write(const void* data, size_t size); 
+/// @brief writes raw bytes on the debug UART (SERCOM3), blocks until every 
+///        byte is sent. 
+/// @param data bytes to send. 
+/// @param size number of bytes to send. 
+void UART_debug_write(const void* data, size_t size); 
+
+
+/// @fn void UART_debug_printf(const char* format, ...); 
+/// @brief prints a formatted string on the debug UART. 
+/// @param format printf like format string. 
+void UART_debug_printf(const char* format, ...); 
+
+#endif
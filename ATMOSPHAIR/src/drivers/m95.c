@@ -14,6 +14,9 @@ static M95_READ_STATES_t    curr_read_state   = M95_RESPONSE_IDLE;
 static uint32_t             err_wait_count    = 1;
 static uint32_t             timeout_count     = 1;
 static M95_WRITE_STATES_t   on_err_next_state = M95_IDLE; 
+static uint32_t             init_step         = 0; 
+static bool                 is_init_step_sent = false; 
+static uint32_t             init_timestamp    = 0; 
 
 static TX_DATA_t            tx_data = {
     .last_command            = NULL, 
@@ -30,6 +33,14 @@ static RX_DATA_t            rx_data = {
 
 //* _ AT COMMANDS LUT __________________________________________________________
 
+static const M95_INIT_STEP_t M95_INIT_LUT[] = {
+    #define X(command, wait)    {command, sizeof(command) - 1, wait}, 
+    
+        M95_INIT_CONFIG
+    #undef X
+};
+
+
 static const AT_COMMAND_t   AT_LUT[] = {
     #define X(id, command, is_post_resp)  \
         {id, command, sizeof(command) - 1, is_post_resp}, 
@@ -39,6 +50,27 @@ static const AT_COMMAND_t   AT_LUT[] = {
 };
 
 
+static const PAYLOAD_FIELD_t PAYLOAD_LUT[] = {
+    #define X(key, field)   {"\"" key "\":", &(SEN6X_data.field)}, 
+    
+        M95_PAYLOAD_FIELDS
+    #undef X
+};
+
+
+static const DIAG_FIELD_t DIAG_LUT[] = {
+    #define X(field, label, key)    {"\"" key "\":", &(SEN6X_diag.field)}, 
+    
+        SEN6X_DIAG_COUNTERS
+    #undef X
+    
+    #define X(field, key)           {"\"" key "\":", &(SSD1362_stats.field)}, 
+    
+        SSD1362_STATS_COUNTERS
+    #undef X
+};
+
+
 //* _ STATIC FUNCTION DECLARATIONS _____________________________________________
 
 // Write state functions.
@@ -58,8 +90,28 @@ static void M95_READ_PROCESS_COMMAND_state(void);
 
 // Utility functions. 
 
+/// @fn static void M95_init_task(void); 
+/// @brief sends the next initialization command once the previous one had 
+///        its execution time. 
+static void M95_init_task(void); 
+
 static void M95_response_buffer_reset(void); 
 static void M95_transmit_buffer_reset(void); 
+
+/// @fn static uint32_t M95_build_payload(char* payload, uint32_t size); 
+/// @brief builds the JSON measurement payload followed by the publish send 
+///        character, formats values without the C library float printf. 
+/// @return the payload length, size if it doesn't fit in the buffer. 
+static uint32_t M95_build_payload(char* payload, uint32_t size); 
+
+/// @fn static uint32_t M95_append_diag(char* payload, uint32_t size, uint32_t len); 
+/// @brief appends the non-zero SEN6x error and display refresh counters as 
+///        a JSON object, leaving room for the end of the payload. 
+/// @param len length of the payload so far. 
+/// @return the new payload length, len if there's nothing to publish or the 
+///         object doesn't fit. 
+static uint32_t M95_append_diag(char* payload, uint32_t size, uint32_t len); 
+
 static void M95_parse_sim_status(const uint8_t* buf); 
 static void M95_parse_signal_strength(const uint8_t* buf); 
 
@@ -80,31 +132,27 @@ static void M95_parse_mqtt_publish(const uint8_t* buf);
 
 void M95_init(void)
 {
-    uint8_t init_command[MAX_TX_COMMAND_SIZE]; 
-    uint8_t dummy[RESPONSE_BUFFER_SIZE]; 
-    
-    // Wait for previous commands to be sent. 
-    while (SERCOM0_USART_WriteCountGet() > 0); 
-    
-    // Send initialization commands.
-    #define X(command, wait)    strncpy(init_command, command, sizeof(command));    \
-                                SERCOM0_USART_Write(init_command, sizeof(command) - 1); \
-                                SYSTICK_DelayMs(wait); 
-        
-        M95_INIT_CONFIG
-    #undef X
-
-    // Clear response data for each initialization command before starting 
-    // both state machines. 
-    if (SERCOM0_USART_ReadCountGet() > 0)
-        SERCOM0_USART_Read(dummy, RESPONSE_BUFFER_SIZE); 
-    
+    init_step         = 0; 
+    is_init_step_sent = false; 
     return; 
 }
 
 
+bool M95_is_ready(void)
+{
+    return init_step >= ARRAY_SIZE(M95_INIT_LUT); 
+}
+
+
 void M95_tasks(void)
 {
+    // Both state machines start once the module is initialized. 
+    if (!M95_is_ready())
+    {
+        M95_init_task(); 
+        return; 
+    }
+    
     // Wrapper to execute both state machines using one line of code (useless). 
     M95_write_task(); 
     M95_read_tasks(); 
@@ -315,28 +363,11 @@ static void M95_VERIFY_COMMAND_state(M95_WRITE_STATES_t on_success, M95_WRITE_ST
 static void M95_PUBLISH_PAYLOAD_state(void)
 {
     size_t      retval; 
-    uint8_t     payload[MAX_TX_COMMAND_SIZE]; 
+    char        payload[MAX_TX_COMMAND_SIZE]; 
     uint32_t    payload_len;
     
     // Build the JSON string that will be sent to the server. 
-    payload_len = snprintf(
-            payload, 
-            MAX_TX_COMMAND_SIZE, 
-            "{\"PM0_5\":%.2f,\"PM1_0\":%.2f,\"PM2_5\":%.2f,\"PM4_0\":%.2f,"
-            "\"PM10_0\":%.2f,\"rh\":%.2f,\"temp\":%.2f,\"VOC\":%.2f,"
-            "\"NOx\":%.2f,\"CO2\":%.2f,\"HCHO\":%.2f}" M95_PUBLISH_SEND_CHAR, 
-            SEN6X_data.PM_0_5, 
-            SEN6X_data.PM_1_0, 
-            SEN6X_data.PM_2_5, 
-            SEN6X_data.PM_4_0, 
-            SEN6X_data.PM_10_0, 
-            SEN6X_data.humidity, 
-            SEN6X_data.temp, 
-            SEN6X_data.VOC, 
-            SEN6X_data.NOx, 
-            SEN6X_data.CO2, 
-            SEN6X_data.HCHO
-        ); 
+    payload_len = M95_build_payload(payload, MAX_TX_COMMAND_SIZE); 
     
     if (payload_len >= MAX_TX_COMMAND_SIZE)
     {
@@ -568,6 +599,140 @@ static void M95_transmit_buffer_reset(void)
 }
 
 
+static void M95_init_task(void)
+{
+    uint8_t dummy[RESPONSE_BUFFER_SIZE]; 
+    
+    if (is_init_step_sent)
+    {
+        if (SYSTICK_millis() - init_timestamp < M95_INIT_LUT[init_step].wait_ms)
+            return; 
+        
+        init_step        += 1; 
+        is_init_step_sent = false; 
+    }
+    
+    // Clear response data for each initialization command before starting 
+    // both state machines. 
+    if (M95_is_ready())
+    {
+        if (SERCOM0_USART_ReadCountGet() > 0)
+            SERCOM0_USART_Read(dummy, RESPONSE_BUFFER_SIZE); 
+        
+        return; 
+    }
+    
+    // Wait for previous commands to be sent. 
+    if (SERCOM0_USART_WriteCountGet() > 0)
+        return; 
+    
+    SERCOM0_USART_Write((uint8_t*)M95_INIT_LUT[init_step].command, M95_INIT_LUT[init_step].length); 
+    init_timestamp    = SYSTICK_millis(); 
+    is_init_step_sent = true; 
+    return; 
+}
+
+
+static uint32_t M95_build_payload(char* payload, uint32_t size)
+{
+    uint32_t    len; 
+    uint32_t    key_len; 
+    uint32_t    value_len; 
+    uint32_t    i; 
+    
+    len = 0; 
+    payload[len++] = '{'; 
+    
+    for (i = 0; i < ARRAY_SIZE(PAYLOAD_LUT); i += 1)
+    {
+        // Measurements the sensor doesn't provide or missing from the last 
+        // sample are not published. 
+        if (!PAYLOAD_LUT[i].value->is_available || !PAYLOAD_LUT[i].value->is_valid)
+            continue; 
+        
+        if (len > 1)
+            payload[len++] = ','; 
+        
+        key_len = strlen(PAYLOAD_LUT[i].key); 
+        if (len + key_len >= size)
+            return size; 
+        
+        memcpy(&payload[len], PAYLOAD_LUT[i].key, key_len); 
+        len += key_len; 
+        
+        value_len = measurement_to_str(&payload[len], size - len, PAYLOAD_LUT[i].value, M95_PAYLOAD_DECIMALS); 
+        if (!value_len)
+            return size; 
+        
+        len += value_len; 
+    }
+    
+    len = M95_append_diag(payload, size, len); 
+    
+    // Closing brace and send character, plus the terminating null. 
+    if (len + 3 > size)
+        return size; 
+    
+    memcpy(&payload[len], "}" M95_PUBLISH_SEND_CHAR, 3); 
+    return len + 2; 
+}
+
+
+static uint32_t M95_append_diag(char* payload, uint32_t size, uint32_t len)
+{
+    const char  header[] = "\"" M95_DIAG_KEY "\":{"; 
+    uint32_t    start_len; 
+    uint32_t    key_len; 
+    uint32_t    value_len; 
+    uint32_t    i; 
+    
+    // The end of the payload must still fit after the object. 
+    if (len + 3 >= size)
+        return len; 
+    
+    size     -= 3; 
+    start_len = len; 
+    
+    if (len > 1)
+        payload[len++] = ','; 
+    
+    if (len + strlen(header) >= size)
+        return start_len; 
+    
+    memcpy(&payload[len], header, strlen(header)); 
+    len += strlen(header); 
+    
+    for (i = 0; i < ARRAY_SIZE(DIAG_LUT); i += 1)
+    {
+        if (*(DIAG_LUT[i].value) == 0)
+            continue; 
+        
+        if (payload[len - 1] != '{')
+            payload[len++] = ','; 
+        
+        key_len = strlen(DIAG_LUT[i].key); 
+        if (len + key_len >= size)
+            return start_len; 
+        
+        memcpy(&payload[len], DIAG_LUT[i].key, key_len); 
+        len += key_len; 
+        
+        value_len = fixed_to_str(&payload[len], size - len, (int32_t)*(DIAG_LUT[i].value), 0); 
+        if (!value_len)
+            return start_len; 
+        
+        len += value_len; 
+    }
+    
+    // No counter to publish. 
+    if (payload[len - 1] == '{' || len + 1 >= size)
+        return start_len; 
+    
+    payload[len++] = '}'; 
+    return len; 
+}
+
+
 static void M95_parse_sim_status(const uint8_t* buf)
 {
     if (CONTAINS(buf, "SIM PIN"))
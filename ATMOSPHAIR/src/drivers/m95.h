@@ -8,6 +8,8 @@
 #include <string.h>
 #include "cores/systick.h"
 #include "sen6x.h"
+#include "ssd1362.h"
+#include "../utils/utils.h"
 
 
 //* _ DEFINITIONS ______________________________________________________________
@@ -63,6 +65,26 @@
 #define M95_MQTT_ALERT_TOPIC    MQTT_DEVICE_NAME "/alert"
 
 
+// JSON fields of the published measurements, in payload order. 
+#define M95_PAYLOAD_DECIMALS    2
+#define M95_PAYLOAD_FIELDS      X("PM0_5",  PM_0_5)     \
+                                X("PM1_0",  PM_1_0)     \
+                                X("PM2_5",  PM_2_5)     \
+                                X("PM4_0",  PM_4_0)     \
+                                X("PM10_0", PM_10_0)    \
+                                X("rh",     humidity)   \
+                                X("temp",   temp)       \
+                                X("VOC",    VOC)        \
+                                X("NOx",    NOx)        \
+                                X("CO2",    CO2)        \
+                                X("HCHO",   HCHO)
+
+// SEN6x error counters and display refresh counters are published in this 
+// JSON object, only the non-zero ones. The object is dropped when it doesn't 
+// fit in the payload. 
+#define M95_DIAG_KEY            "diag"
+
+
 #define CONTAINS(buf, str)      (strstr(buf, str) != NULL)
 
 #define IS_ALPHA_CHAR(c)        ((c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z'))
@@ -156,6 +178,28 @@ typedef struct at_command
 }   AT_COMMAND_t;
 
 
+typedef struct m95_init_step
+{
+    const char*             command;    ///< Initialization AT command. 
+    const size_t            length;     ///< Length of the command. 
+    const uint32_t          wait_ms;    ///< Time given to the module to execute the command. 
+}   M95_INIT_STEP_t;
+
+
+typedef struct payload_field
+{
+    const char*             key;    ///< JSON key with its quotes and colon. 
+    const MEASUREMENT_t*    value;  ///< Measurement published under this key. 
+}   PAYLOAD_FIELD_t;
+
+
+typedef struct diag_field
+{
+    const char*             key;    ///< JSON key with its quotes and colon. 
+    const uint32_t*         value;  ///< Counter published under this key. 
+}   DIAG_FIELD_t;
+
+
 typedef struct tx_data
 {
     AT_COMMAND_STATUS_t status; 
@@ -199,10 +243,16 @@ extern MQTT_CONN_STATUS_t  MQTT_status;
 //* _ FUNCTION DECLARATIONS ____________________________________________________
 
 /// @fn void M95_init(void); 
-/// @brief turns on the module and sends all initialization commands. 
+/// @brief restarts the initialization commands sequence, the commands are 
+///        sent one by one by M95_tasks. 
 void M95_init(void); 
 
 
+/// @fn bool M95_is_ready(void); 
+/// @brief boot step, every initialization command has been sent. 
+bool M95_is_ready(void); 
+
+
 /// @fn void M95_tasks(void); 
 /// @brief maintains both read and write state machines. 
 void M95_tasks(void); 
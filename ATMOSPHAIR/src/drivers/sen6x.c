@@ -3,59 +3,333 @@
 
 //* _ GLOBAL VARIABLE DECLARATIONS _____________________________________________
 
-SEN6X_DATA_t SEN6X_data; 
+SEN6X_DATA_t            SEN6X_data; 
+SEN6X_DIAG_t            SEN6X_diag; 
+const SEN6X_MODEL_t*    SEN6X_model; 
 
 
 //* _ STATIC VARIABLES _________________________________________________________
 
-static SEN6X_STATES_t   curr_state                      = SEN6X_IDLE; 
+static SEN6X_STATES_t   curr_state                      = SEN6X_DETECT; 
 static uint8_t          rx_buffer[SEN6X_RX_BUF_LENGTH]  = {0}; 
-static uint8_t          tx_buffer[SEN6X_COMMAND_LENGTH] = {0}; 
-static uint16_t         last_command_executed           = 0; 
+static SEN6X_DATA_t     back_buffer                     = {0}; 
 static uint32_t         last_command_timestamp          = 0; 
+static uint32_t         last_sample_timestamp           = 0; 
+static uint32_t         consecutive_errors              = 0; 
+static bool             is_measuring                    = false; 
+static bool             has_sample                      = false; 
+
+// Queued requests, the head one is being executed. A poll is due after each 
+// request so the samples keep being read. 
+static SEN6X_REQUEST_t  request_queue[SEN6X_REQUEST_QUEUE_LENGTH]; 
+static uint32_t         request_head                    = 0; 
+static uint32_t         request_count                   = 0; 
+static uint8_t          request_rx_buffer[SEN6X_REQUEST_MAX_WORDS * SEN6X_WORD_LENGTH]; 
+static bool             is_poll_due                     = false; 
+
+
+//* _ MEASUREMENT FRAME DESCRIPTORS ____________________________________________
+
+static const SEN6X_FIELD_t SEN60_FIELDS[] = {
+    {.word = 0, .divider = 10,  .is_signed = false, .dest = &(back_buffer.PM_1_0)}, 
+    {.word = 1, .divider = 10,  .is_signed = false, .dest = &(back_buffer.PM_2_5)}, 
+    {.word = 2, .divider = 10,  .is_signed = false, .dest = &(back_buffer.PM_4_0)}, 
+    {.word = 3, .divider = 10,  .is_signed = false, .dest = &(back_buffer.PM_10_0)}, 
+    {.word = 4, .divider = 100, .is_signed = true,  .dest = &(back_buffer.PM_0_5)}, 
+}; 
+
+
+static const SEN6X_FIELD_t SEN63C_FIELDS[] = {
+    {.word = 0, .divider = 10,  .is_signed = false, .dest = &(back_buffer.PM_1_0)}, 
+    {.word = 1, .divider = 10,  .is_signed = false, .dest = &(back_buffer.PM_2_5)}, 
+    {.word = 2, .divider = 10,  .is_signed = false, .dest = &(back_buffer.PM_4_0)}, 
+    {.word = 3, .divider = 10,  .is_signed = false, .dest = &(back_buffer.PM_10_0)}, 
+    {.word = 4, .divider = 100, .is_signed = true,  .dest = &(back_buffer.humidity)}, 
+    {.word = 5, .divider = 200, .is_signed = true,  .dest = &(back_buffer.temp)}, 
+    {.word = 6, .divider = 1,   .is_signed = true,  .dest = &(back_buffer.CO2)}, 
+}; 
+
+
+static const SEN6X_FIELD_t SEN65_FIELDS[] = {
+    {.word = 0, .divider = 10,  .is_signed = false, .dest = &(back_buffer.PM_1_0)}, 
+    {.word = 1, .divider = 10,  .is_signed = false, .dest = &(back_buffer.PM_2_5)}, 
+    {.word = 2, .divider = 10,  .is_signed = false, .dest = &(back_buffer.PM_4_0)}, 
+    {.word = 3, .divider = 10,  .is_signed = false, .dest = &(back_buffer.PM_10_0)}, 
+    {.word = 4, .divider = 100, .is_signed = true,  .dest = &(back_buffer.humidity)}, 
+    {.word = 5, .divider = 200, .is_signed = true,  .dest = &(back_buffer.temp)}, 
+    {.word = 6, .divider = 10,  .is_signed = true,  .dest = &(back_buffer.VOC)}, 
+    {.word = 7, .divider = 10,  .is_signed = true,  .dest = &(back_buffer.NOx)}, 
+}; 
+
+
+static const SEN6X_FIELD_t SEN66_FIELDS[] = {
+    {.word = 0, .divider = 10,  .is_signed = false, .dest = &(back_buffer.PM_1_0)}, 
+    {.word = 1, .divider = 10,  .is_signed = false, .dest = &(back_buffer.PM_2_5)}, 
+    {.word = 2, .divider = 10,  .is_signed = false, .dest = &(back_buffer.PM_4_0)}, 
+    {.word = 3, .divider = 10,  .is_signed = false, .dest = &(back_buffer.PM_10_0)}, 
+    {.word = 4, .divider = 100, .is_signed = true,  .dest = &(back_buffer.humidity)}, 
+    {.word = 5, .divider = 200, .is_signed = true,  .dest = &(back_buffer.temp)}, 
+    {.word = 6, .divider = 10,  .is_signed = true,  .dest = &(back_buffer.VOC)}, 
+    {.word = 7, .divider = 10,  .is_signed = true,  .dest = &(back_buffer.NOx)}, 
+    {.word = 8, .divider = 1,   .is_signed = false, .dest = &(back_buffer.CO2)}, 
+}; 
+
+
+static const SEN6X_FIELD_t SEN68_FIELDS[] = {
+    {.word = 0, .divider = 10,  .is_signed = false, .dest = &(back_buffer.PM_1_0)}, 
+    {.word = 1, .divider = 10,  .is_signed = false, .dest = &(back_buffer.PM_2_5)}, 
+    {.word = 2, .divider = 10,  .is_signed = false, .dest = &(back_buffer.PM_4_0)}, 
+    {.word = 3, .divider = 10,  .is_signed = false, .dest = &(back_buffer.PM_10_0)}, 
+    {.word = 4, .divider = 100, .is_signed = true,  .dest = &(back_buffer.humidity)}, 
+    {.word = 5, .divider = 200, .is_signed = true,  .dest = &(back_buffer.temp)}, 
+    {.word = 6, .divider = 10,  .is_signed = true,  .dest = &(back_buffer.VOC)}, 
+    {.word = 7, .divider = 10,  .is_signed = true,  .dest = &(back_buffer.NOx)}, 
+    {.word = 8, .divider = 10,  .is_signed = false, .dest = &(back_buffer.HCHO)}, 
+}; 
+
+
+static const SEN6X_MODEL_t SEN6X_MODEL_LUT[SEN6X_MODEL_COUNT] = {
+    [SEN60] = {
+        .name               = "SEN60", 
+        .addr               = SEN60_ADDR, 
+        .commands           = {
+            [DEVICE_RESET]      = 0x3F8D, 
+            [START_MEASUREMENT] = 0x2152, 
+            [STOP_MEASUREMENT]  = 0x3F86, 
+            [GET_DATA_READY]    = 0xE4B8, 
+            [READ_MEASURED]     = 0xEC05, 
+        }, 
+        .measurement_length = 15, 
+        .fields             = SEN60_FIELDS, 
+        .field_count        = ARRAY_SIZE(SEN60_FIELDS), 
+    }, 
+    [SEN63C] = {
+        .name               = "SEN63C", 
+        .addr               = SEN6X_ADDR, 
+        .commands           = {
+            [DEVICE_RESET]      = 0xD304, 
+            [START_MEASUREMENT] = 0x0021, 
+            [STOP_MEASUREMENT]  = 0x0104, 
+            [GET_DATA_READY]    = 0x0202, 
+            [READ_MEASURED]     = 0x0471, 
+            [GET_PRODUCT_NAME]  = 0xD014, 
+            [READ_RAW_VALUES]           = 0x0492, 
+            [READ_NUMBER_CONCENTRATION] = 0x0316, 
+            [START_FAN_CLEANING]        = 0x5607, 
+            [SET_TEMPERATURE_OFFSET]    = 0x60B2, 
+            [FORCED_CO2_RECALIBRATION]  = 0x6707, 
+            [GET_SERIAL_NUMBER]         = 0xD033, 
+        }, 
+        .measurement_length = 21, 
+        .fields             = SEN63C_FIELDS, 
+        .field_count        = ARRAY_SIZE(SEN63C_FIELDS), 
+    }, 
+    [SEN65] = {
+        .name               = "SEN65", 
+        .addr               = SEN6X_ADDR, 
+        .commands           = {
+            [DEVICE_RESET]      = 0xD304, 
+            [START_MEASUREMENT] = 0x0021, 
+            [STOP_MEASUREMENT]  = 0x0104, 
+            [GET_DATA_READY]    = 0x0202, 
+            [READ_MEASURED]     = 0x0446, 
+            [GET_PRODUCT_NAME]  = 0xD014, 
+            [READ_RAW_VALUES]           = 0x0455, 
+            [READ_NUMBER_CONCENTRATION] = 0x0316, 
+            [START_FAN_CLEANING]        = 0x5607, 
+            [SET_TEMPERATURE_OFFSET]    = 0x60B2, 
+            [GET_SERIAL_NUMBER]         = 0xD033, 
+        }, 
+        .measurement_length = 24, 
+        .fields             = SEN65_FIELDS, 
+        .field_count        = ARRAY_SIZE(SEN65_FIELDS), 
+    }, 
+    [SEN66] = {
+        .name               = "SEN66", 
+        .addr               = SEN6X_ADDR, 
+        .commands           = {
+            [DEVICE_RESET]      = 0xD304, 
+            [START_MEASUREMENT] = 0x0021, 
+            [STOP_MEASUREMENT]  = 0x0104, 
+            [GET_DATA_READY]    = 0x0202, 
+            [READ_MEASURED]     = 0x0300, 
+            [GET_PRODUCT_NAME]  = 0xD014, 
+            [READ_RAW_VALUES]           = 0x0405, 
+            [READ_NUMBER_CONCENTRATION] = 0x0316, 
+            [START_FAN_CLEANING]        = 0x5607, 
+            [SET_TEMPERATURE_OFFSET]    = 0x60B2, 
+            [FORCED_CO2_RECALIBRATION]  = 0x6707, 
+            [GET_SERIAL_NUMBER]         = 0xD033, 
+        }, 
+        .measurement_length = 27, 
+        .fields             = SEN66_FIELDS, 
+        .field_count        = ARRAY_SIZE(SEN66_FIELDS), 
+    }, 
+    [SEN68] = {
+        .name               = "SEN68", 
+        .addr               = SEN6X_ADDR, 
+        .commands           = {
+            [DEVICE_RESET]      = 0xD304, 
+            [START_MEASUREMENT] = 0x0021, 
+            [STOP_MEASUREMENT]  = 0x0104, 
+            [GET_DATA_READY]    = 0x0202, 
+            [READ_MEASURED]     = 0x0767, 
+            [GET_PRODUCT_NAME]  = 0xD014, 
+            [READ_RAW_VALUES]           = 0x0455, 
+            [READ_NUMBER_CONCENTRATION] = 0x0316, 
+            [START_FAN_CLEANING]        = 0x5607, 
+            [SET_TEMPERATURE_OFFSET]    = 0x60B2, 
+            [GET_SERIAL_NUMBER]         = 0xD033, 
+        }, 
+        .measurement_length = 27, 
+        .fields             = SEN68_FIELDS, 
+        .field_count        = ARRAY_SIZE(SEN68_FIELDS), 
+    }, 
+}; 
 
 
 //* _ STATIC FUNCTION DECLARATIONS _____________________________________________
 
+static void     SEN6X_DETECT_state(void); 
+static void     SEN6X_CONFIG_state(void); 
 static void     SEN6X_IDLE_state(void); 
 static void     SEN6X_MEASUREMENT_state(void); 
 static void     SEN6X_WAIT_DATA_state(void); 
 static void     SEN6X_READ_DATA_state(void); 
 static void     SEN6X_PARSE_DATA_state(void); 
-
-static void     SEN6X_data_init(SEN6X_DATA_t* data);
-static uint16_t get_command_wait_time(uint16_t command); 
-static void     process_data(uint8_t* src, float divider, bool is_signed, float* dest); 
+static void     SEN6X_REQUEST_state(void); 
+static void     SEN6X_RECOVER_state(void); 
+
+/// @fn static bool SEN6X_submit_command(const SEN6X_MODEL_t* model, SEN6X_COMMAND_t command, uint8_t rx_length); 
+/// @brief queues a command of a model on the I²C engine, the answer is read 
+///        in rx_buffer after the command execution time. 
+/// @param model detected model, or the probed one during detection. 
+/// @param rx_length length of the answer, 0 for a write only command. 
+/// @return false if the I²C queue is full. 
+static bool     SEN6X_submit_command(const SEN6X_MODEL_t* model, SEN6X_COMMAND_t command, uint8_t rx_length); 
+
+/// @fn static void SEN6X_command_callback(I2C_RESULT_t result, uintptr_t context); 
+/// @brief moves the state machine on once a command transaction is over. 
+/// @param context the SEN6X_COMMAND_t of the transaction. 
+static void     SEN6X_command_callback(I2C_RESULT_t result, uintptr_t context); 
+
+/// @fn static bool SEN6X_submit_request(const SEN6X_REQUEST_t* request); 
+/// @brief queues a request on the I²C engine, the arguments are sent with 
+///        their CRC. 
+/// @return false if the I²C queue is full. 
+static bool     SEN6X_submit_request(const SEN6X_REQUEST_t* request); 
+
+/// @fn static void SEN6X_request_callback(I2C_RESULT_t result, uintptr_t context); 
+/// @brief removes the head request from the queue, checks its answer and 
+///        notifies it. 
+/// @param context not used. 
+static void     SEN6X_request_callback(I2C_RESULT_t result, uintptr_t context); 
+
+/// @fn static void SEN6X_count_result(I2C_RESULT_t result); 
+/// @brief counts a failed command by cause, too many failures in a row 
+///        start a bus recovery. A successful one resets the failure count. 
+static void     SEN6X_count_result(I2C_RESULT_t result); 
+
+/// @fn static void SEN6X_check_stale(void); 
+/// @brief starts a bus recovery when no sample arrived for 
+///        SEN6X_STALE_TIMEOUT_MS. 
+static void     SEN6X_check_stale(void); 
+
+/// @fn static void SEN6X_start_recovery(void); 
+/// @brief invalidates the published sample and moves to the recovery state. 
+static void     SEN6X_start_recovery(void); 
+
+/// @fn static void SEN6X_publish(void); 
+/// @brief publishes the back buffer as the new sample. 
+static void     SEN6X_publish(void); 
+
+static void     SEN6X_data_init(SEN6X_DATA_t* data, const SEN6X_MODEL_t* model);
+
+/// @fn static const SEN6X_MODEL_t* SEN6X_match_product_name(const uint8_t* frame); 
+/// @brief finds the model of a GET_PRODUCT_NAME answer. 
+/// @return NULL if a word is corrupted or the name is unknown. 
+static const SEN6X_MODEL_t* SEN6X_match_product_name(const uint8_t* frame); 
+
+static uint16_t get_command_wait_time(SEN6X_COMMAND_t command); 
+
+/// @fn static bool command_needs_idle(SEN6X_COMMAND_t command); 
+/// @brief tells if the sensor only accepts the command in idle mode. 
+static bool     command_needs_idle(SEN6X_COMMAND_t command); 
+static void     decode_frame(const uint8_t* frame, uint32_t length, const SEN6X_FIELD_t* fields, uint32_t field_count); 
 
 
 //* _  FUNCTION IMPLEMENTATION _________________________________________________
 
 void SEN6X_init(void)
 {
-    uint8_t command[2]; 
-    
-    SEN6X_data_init(&SEN6X_data);
-    
-    // Wait for the I²C peripheral to be available. 
-    while (SERCOM1_I2C_IsBusy()); 
+    SEN6X_model  = NULL; 
+    is_measuring = false; 
+    has_sample   = false; 
+    curr_state   = SEN6X_DETECT; 
+    return;
+}
 
-    #define X(reg)  command[0] = (reg >> 8);                                        \
-                    command[1] = (reg & 0xFF);                                      \
-                    SERCOM1_I2C_Write(SEN6X_ADDR, command, SEN6X_COMMAND_LENGTH);   \
-                    while (SERCOM1_I2C_IsBusy());                                   \
-                    SYSTICK_DelayMs(DEVICE_RESET_WAIT_TIME);                                          
 
-        SEN6X_INIT_CONFIG
-    #undef X
+bool SEN6X_is_ready(void)
+{
+    return is_measuring; 
+}
 
-    return;
+
+bool SEN6X_has_sample(void)
+{
+    return has_sample; 
+}
+
+
+bool SEN6X_request(SEN6X_COMMAND_t command, const uint16_t* args, uint8_t arg_count, uint8_t rx_words, SEN6X_REQUEST_CALLBACK_t callback, uintptr_t context)
+{
+    SEN6X_REQUEST_t*    request; 
+    uint32_t            i; 
+    
+    if (!SEN6X_model || command >= SEN6X_COMMAND_COUNT || !SEN6X_model->commands[command])
+        return false; 
+    
+    if (request_count >= SEN6X_REQUEST_QUEUE_LENGTH)
+        return false; 
+    
+    if (arg_count > SEN6X_REQUEST_MAX_ARGS || rx_words > SEN6X_REQUEST_MAX_WORDS)
+        return false; 
+    
+    request = &request_queue[(request_head + request_count) % SEN6X_REQUEST_QUEUE_LENGTH]; 
+    *request = (SEN6X_REQUEST_t){
+        .command    = command, 
+        .arg_count  = arg_count, 
+        .rx_words   = rx_words, 
+        .wait_ms    = get_command_wait_time(command), 
+        .needs_idle = command_needs_idle(command), 
+        .callback   = callback, 
+        .context    = context, 
+    }; 
+    
+    for (i = 0; i < arg_count; i += 1)
+        request->args[i] = args[i]; 
+    
+    request_count += 1; 
+    return true; 
 }
 
 
 void SEN6X_task(void)
 {
+    SEN6X_check_stale(); 
+    
     switch (curr_state)
     {
+        case SEN6X_DETECT:
+        case SEN6X_DETECT_SEN60:
+            SEN6X_DETECT_state();
+            break; 
+            
+        case SEN6X_CONFIG:
+            SEN6X_CONFIG_state();
+            break; 
+            
         case SEN6X_IDLE:
             SEN6X_IDLE_state();
             break; 
@@ -64,13 +338,11 @@ void SEN6X_task(void)
             SEN6X_MEASUREMENT_state(); 
             break; 
             
-        case SEN6X_WAIT_DATA_W:
-        case SEN6X_WAIT_DATA_R:
+        case SEN6X_WAIT_DATA:
             SEN6X_WAIT_DATA_state();
             break; 
                 
-        case SEN6X_READ_DATA_W:
-        case SEN6X_READ_DATA_R:
+        case SEN6X_READ_DATA:
             SEN6X_READ_DATA_state();
             break; 
             
@@ -78,6 +350,18 @@ void SEN6X_task(void)
             SEN6X_PARSE_DATA_state(); 
             break; 
             
+        case SEN6X_REQUEST: 
+            SEN6X_REQUEST_state(); 
+            break; 
+            
+        case SEN6X_BUSY: 
+            // Moved on by SEN6X_command_callback or SEN6X_request_callback. 
+            break; 
+            
+        case SEN6X_RECOVER: 
+            SEN6X_RECOVER_state(); 
+            break; 
+            
         default: 
             curr_state = SEN6X_IDLE; 
             break; 
@@ -89,6 +373,42 @@ void SEN6X_task(void)
 
 //* _ STATES FUNCTION IMPLEMENTATION ___________________________________________
 
+static void SEN6X_DETECT_state(void)
+{
+    bool retval; 
+    
+    // Every model but the SEN60 answers to the product name command on the 
+    // shared address. The SEN60 has no such command, its address 
+    // acknowledging a stop command is enough to identify it. 
+    if (curr_state == SEN6X_DETECT)
+        retval = SEN6X_submit_command(&SEN6X_MODEL_LUT[SEN66], GET_PRODUCT_NAME, SEN6X_PRODUCT_NAME_LENGTH / 2 * SEN6X_WORD_LENGTH); 
+    
+    else
+        retval = SEN6X_submit_command(&SEN6X_MODEL_LUT[SEN60], STOP_MEASUREMENT, 0); 
+    
+    if (retval)
+        curr_state = SEN6X_BUSY; 
+    
+    return; 
+}
+
+
+static void SEN6X_CONFIG_state(void)
+{
+    SEN6X_data_init(&back_buffer, SEN6X_model);
+    SEN6X_data = back_buffer; 
+
+    // The commands are queued, the measurement starts once they are executed. 
+    #define X(id)   SEN6X_submit_command(SEN6X_model, id, 0); 
+
+        SEN6X_INIT_CONFIG
+    #undef X
+    
+    curr_state = SEN6X_IDLE; 
+    return; 
+}
+
+
 static void SEN6X_IDLE_state(void)
 {
     curr_state = SEN6X_MEASUREMENT; 
@@ -98,189 +418,280 @@ static void SEN6X_IDLE_state(void)
 
 static void SEN6X_MEASUREMENT_state(void)
 {
-    bool retval; 
+    if (SEN6X_submit_command(SEN6X_model, START_MEASUREMENT, 0))
+        curr_state = SEN6X_BUSY; 
     
-    retval = false; 
-    
-    // Abort if the I²C bus is busy. 
-    if (SERCOM1_I2C_IsBusy())
+    return; 
+}
+
+
+static void SEN6X_WAIT_DATA_state(void)
+{
+    // Requests are run while waiting for the next sample, alternating with 
+    // the polls so a long queue doesn't delay the samples. 
+    if (request_count > 0 && !is_poll_due)
+    {
+        curr_state = SEN6X_REQUEST; 
         return; 
+    }
     
-    // Build the command to send. 
-    tx_buffer[0] = (uint8_t)(START_MEASUREMENT >> 8);
-    tx_buffer[1] = (uint8_t)(START_MEASUREMENT & 0xFF);
-    
-    // Send the command to the I²C bus. 
-    retval = SERCOM1_I2C_Write(SEN6X_ADDR, tx_buffer, SEN6X_COMMAND_LENGTH); 
-    if (!retval)
+    // Poll the data ready flag once per read execution time. 
+    if (SYSTICK_millis() - last_command_timestamp < get_command_wait_time(GET_DATA_READY))
         return; 
     
-    // If the command has been successfully sent, save the timestamp and go to 
-    // the next state. 
-    last_command_executed  = START_MEASUREMENT; 
-    last_command_timestamp = SYSTICK_millis(); 
-    curr_state             = SEN6X_WAIT_DATA_W; 
+    if (SEN6X_submit_command(SEN6X_model, GET_DATA_READY, SEN6X_WORD_LENGTH))
+    {
+        is_poll_due = false; 
+        curr_state  = SEN6X_BUSY; 
+    }
+    
     return; 
 }
 
 
-static void SEN6X_WAIT_DATA_state(void)
+static void SEN6X_READ_DATA_state(void)
 {
-    bool        retval; 
-    uint16_t    wait_time; 
+    if (SEN6X_submit_command(SEN6X_model, READ_MEASURED, SEN6X_model->measurement_length))
+        curr_state = SEN6X_BUSY; 
     
-    retval    = false; 
-    wait_time = get_command_wait_time(last_command_executed); 
+    return; 
+}
+
+
+static void SEN6X_PARSE_DATA_state(void)
+{
+    // The frame is decoded in the back buffer, then published as a whole so 
+    // no consumer reads a mix of two samples. 
+    decode_frame(rx_buffer, SEN6X_model->measurement_length, SEN6X_model->fields, SEN6X_model->field_count); 
+    SEN6X_publish(); 
+    has_sample            = true; 
+    last_sample_timestamp = SYSTICK_millis(); 
+    
+    curr_state = SEN6X_WAIT_DATA; 
+    return; 
+}
+
+
+static void SEN6X_REQUEST_state(void)
+{
+    const SEN6X_REQUEST_t* request; 
     
-    // Wait for the DATA_READY command to be fully executed on the sensor side. 
-    if (SYSTICK_millis() - last_command_timestamp <= wait_time)
+    // The stop, the command and the start have to fit in the I²C queue. 
+    if (!I2C_is_idle())
         return; 
     
-    // Abort if the I²C bus is busy. 
-    if (SERCOM1_I2C_IsBusy())
-        return; 
+    request = &request_queue[request_head]; 
     
-    // Send the command to the I²C bus. 
-    if (curr_state == SEN6X_WAIT_DATA_W)
+    // Idle mode commands are wrapped in a stop and a start, the start 
+    // callback moves back to polling. 
+    if (request->needs_idle)
     {
-        // Build the command to send. 
-        tx_buffer[0] = (uint8_t)(GET_DATA_READY >> 8);
-        tx_buffer[1] = (uint8_t)(GET_DATA_READY & 0xFF);
-        retval = SERCOM1_I2C_Write(SEN6X_ADDR, tx_buffer, SEN6X_COMMAND_LENGTH);  
+        SEN6X_submit_command(SEN6X_model, STOP_MEASUREMENT, 0); 
+        is_measuring = false; 
     }
     
-    else if (curr_state == SEN6X_WAIT_DATA_R)
-        retval = SERCOM1_I2C_Read(SEN6X_ADDR, rx_buffer, 3); 
+    SEN6X_submit_request(request); 
+    
+    if (request->needs_idle)
+        SEN6X_submit_command(SEN6X_model, START_MEASUREMENT, 0); 
     
-    if (!retval)
+    curr_state = SEN6X_BUSY; 
+    return; 
+}
+
+
+static void SEN6X_RECOVER_state(void)
+{
+    // Commands still queued have to fail or time out first. 
+    if (!I2C_is_idle())
         return; 
     
-    // If the command has been successfully sent, save the timestamp and go to 
-    // the next state. 
-    last_command_executed  = GET_DATA_READY;
-    last_command_timestamp = SYSTICK_millis(); 
-    curr_state             += 1; 
+    // Release the bus, then reset the sensor and restart the measurement 
+    // like at boot. The detected model is kept. 
+    I2C_bus_recover(); 
+    SEN6X_diag.recovery_count += 1; 
+    consecutive_errors         = 0; 
+    curr_state                 = SEN6X_CONFIG; 
     return; 
 }
 
 
-static void SEN6X_READ_DATA_state(void)
+static void SEN6X_command_callback(I2C_RESULT_t result, uintptr_t context)
 {
-    bool        retval; 
-    uint16_t    wait_time; 
+    bool is_success; 
     
-    retval = false; 
-    wait_time = get_command_wait_time(last_command_executed); 
+    last_command_timestamp = SYSTICK_millis(); 
+    is_success             = result == I2C_SUCCESS; 
     
-    // Wait for the READ_MEASURED_SEN6x command to be fully executed on the 
-    // sensor side. 
-    if (SYSTICK_millis() - last_command_timestamp <= 25)
-        return; 
+    // Probing a model that isn't there is expected during the detection, 
+    // only the failures of the detected sensor are counted. 
+    if (SEN6X_model)
+        SEN6X_count_result(result); 
     
-    // Abort if the I²C bus is busy. 
-    if (SERCOM1_I2C_IsBusy())
+    // The commands queued before the recovery started don't move the state 
+    // machine. 
+    if (curr_state == SEN6X_RECOVER)
         return; 
     
-    // Data is not ready, go back to the WAIT_DATA state. 
-    if (curr_state == SEN6X_READ_DATA_W && rx_buffer[1] == 0)
+    switch ((SEN6X_COMMAND_t)context)
     {
-        curr_state = SEN6X_WAIT_DATA_W; 
-        return; 
+        case GET_PRODUCT_NAME: 
+            SEN6X_model = is_success ? SEN6X_match_product_name(rx_buffer) : NULL; 
+            curr_state  = SEN6X_model ? SEN6X_CONFIG : SEN6X_DETECT_SEN60; 
+            break; 
+            
+        case STOP_MEASUREMENT: 
+            // Only the SEN60 probe is followed during the detection, falls 
+            // back to the default model if nothing answered. 
+            if (SEN6X_model)
+                break; 
+            
+            SEN6X_model = &SEN6X_MODEL_LUT[is_success ? SEN60 : SEN_DEVICE_DEFAULT]; 
+            curr_state  = SEN6X_CONFIG; 
+            break; 
+            
+        case START_MEASUREMENT: 
+            // The stale timeout runs from the start of the measurement until 
+            // the first sample. 
+            is_measuring          = is_success; 
+            last_sample_timestamp = last_command_timestamp; 
+            curr_state            = is_success ? SEN6X_WAIT_DATA : SEN6X_MEASUREMENT; 
+            break; 
+            
+        case GET_DATA_READY: 
+            if (is_success && crc_8_check(rx_buffer, SEN6X_WORD_LENGTH) != 0)
+            {
+                SEN6X_diag.crc_count += 1; 
+                is_success            = false; 
+            }
+            
+            // Data is not ready, keep polling. 
+            if (is_success && rx_buffer[1] != 0)
+                curr_state = SEN6X_READ_DATA; 
+            
+            else
+                curr_state = SEN6X_WAIT_DATA; 
+            break; 
+            
+        case READ_MEASURED: 
+            curr_state = is_success ? SEN6X_PARSE_DATA : SEN6X_WAIT_DATA; 
+            break; 
+            
+        default: 
+            break; 
     }
     
-    // Send the command to the I²C bus. 
-    if (curr_state == SEN6X_READ_DATA_W)
+    return; 
+}
+
+
+static void SEN6X_request_callback(I2C_RESULT_t result, uintptr_t context)
+{
+    SEN6X_REQUEST_t request; 
+    uint16_t        words[SEN6X_REQUEST_MAX_WORDS]; 
+    uint32_t        i; 
+    bool            is_success; 
+    
+    // The request leaves the queue before its callback so it can queue the 
+    // next one. 
+    request       = request_queue[request_head]; 
+    request_head  = (request_head + 1) % SEN6X_REQUEST_QUEUE_LENGTH; 
+    request_count -= 1; 
+    
+    last_command_timestamp = SYSTICK_millis(); 
+    is_success             = result == I2C_SUCCESS; 
+    SEN6X_count_result(result); 
+    
+    if (is_success && crc_8_bad_words(request_rx_buffer, request.rx_words) != 0)
     {
-        // Build the command to send. 
-        tx_buffer[0] = (uint8_t)(READ_MEASURED >> 8);
-        tx_buffer[1] = (uint8_t)(READ_MEASURED & 0xFF);
-        retval = SERCOM1_I2C_Write(SEN6X_ADDR, tx_buffer, SEN6X_COMMAND_LENGTH); 
+        SEN6X_diag.crc_count += 1; 
+        is_success            = false; 
     }
     
-    else if (curr_state == SEN6X_READ_DATA_R)
-        retval = SERCOM1_I2C_Read(SEN6X_ADDR, rx_buffer, SEN6X_MEASUREMENT_LENGTH); 
+    for (i = 0; is_success && i < request.rx_words; i += 1)
+        words[i] = request_rx_buffer[i * SEN6X_WORD_LENGTH] << 8 | request_rx_buffer[i * SEN6X_WORD_LENGTH + 1]; 
+    
+    // An idle mode request is followed by the start of the measurement. 
+    if (curr_state != SEN6X_RECOVER && !request.needs_idle)
+        curr_state = SEN6X_WAIT_DATA; 
+    
+    is_poll_due = true; 
+    if (request.callback)
+        request.callback(is_success, words, is_success ? request.rx_words : 0, request.context); 
+    
+    return; 
+}
 
-    if (!retval)
-        return; 
+
+//* _ FAULT HANDLING FUNCTIONS _________________________________________________
+
+static void SEN6X_count_result(I2C_RESULT_t result)
+{
+    switch (result)
+    {
+        case I2C_SUCCESS: 
+            consecutive_errors = 0; 
+            return; 
+            
+        case I2C_ERROR_NAK: 
+            SEN6X_diag.nack_count += 1; 
+            break; 
+            
+        case I2C_ERROR_TIMEOUT: 
+            SEN6X_diag.timeout_count += 1; 
+            break; 
+            
+        default: 
+            SEN6X_diag.bus_error_count += 1; 
+            break; 
+    }
+    
+    consecutive_errors += 1; 
+    if (consecutive_errors >= SEN6X_MAX_CONSECUTIVE_ERRORS && curr_state != SEN6X_RECOVER)
+        SEN6X_start_recovery(); 
     
-    // If the command has been successfully sent, save the timestamp and go to 
-    // the next state. 
-    last_command_executed  = READ_MEASURED; 
-    last_command_timestamp = SYSTICK_millis(); 
-    curr_state             += 1; 
     return; 
 }
 
 
-static void SEN6X_PARSE_DATA_state(void)
+static void SEN6X_check_stale(void)
 {
-    if (SYSTICK_millis() - last_command_timestamp <= 25)
+    if (!is_measuring || SYSTICK_millis() - last_sample_timestamp < SEN6X_STALE_TIMEOUT_MS)
         return; 
     
-    #if SEN_DEVICE_USED == SEN60
-        process_data(rx_buffer + 0, 10, false, &(SEN6X_data.PM_1_0)); 
-        process_data(rx_buffer + 3, 10, false, &(SEN6X_data.PM_2_5)); 
-        process_data(rx_buffer + 6, 10, false, &(SEN6X_data.PM_4_0)); 
-        process_data(rx_buffer + 9, 10, false, &(SEN6X_data.PM_10_0));
-        process_data(rx_buffer + 12, 100, true, &(SEN6X_data.PM_0_5));  
-    
-    #elif SEN_DEVICE_USED == SEN63C
-        process_data(rx_buffer + 0, 10, false, &(SEN6X_data.PM_1_0)); 
-        process_data(rx_buffer + 3, 10, false, &(SEN6X_data.PM_2_5)); 
-        process_data(rx_buffer + 6, 10, false, &(SEN6X_data.PM_4_0)); 
-        process_data(rx_buffer + 9, 10, false, &(SEN6X_data.PM_10_0));
-
-        process_data(rx_buffer + 12, 100, true, &(SEN6X_data.humidity)); 
-        process_data(rx_buffer + 15, 200, true, &(SEN6X_data.temp)); 
-        process_data(rx_buffer + 18, 1, true, &(SEN6X_data.CO2)); 
-    
-    #elif SEN_DEVICE_USED == SEN65
-        process_data(rx_buffer + 0, 10, false, &(SEN6X_data.PM_1_0)); 
-        process_data(rx_buffer + 3, 10, false, &(SEN6X_data.PM_2_5)); 
-        process_data(rx_buffer + 6, 10, false, &(SEN6X_data.PM_4_0)); 
-        process_data(rx_buffer + 9, 10, false, &(SEN6X_data.PM_10_0));
-
-        process_data(rx_buffer + 12, 100, true, &(SEN6X_data.humidity)); 
-        process_data(rx_buffer + 15, 200, true, &(SEN6X_data.temp)); 
-        process_data(rx_buffer + 18, 10, true, &(SEN6X_data.VOC)); 
-        process_data(rx_buffer + 21, 10, true, &(SEN6X_data.NOx)); 
-    
-    #elif SEN_DEVICE_USED == SEN66
-        process_data(rx_buffer + 0, 10, false, &(SEN6X_data.PM_1_0)); 
-        process_data(rx_buffer + 3, 10, false, &(SEN6X_data.PM_2_5)); 
-        process_data(rx_buffer + 6, 10, false, &(SEN6X_data.PM_4_0)); 
-        process_data(rx_buffer + 9, 10, false, &(SEN6X_data.PM_10_0));
-
-        process_data(rx_buffer + 12, 100, true, &(SEN6X_data.humidity)); 
-        process_data(rx_buffer + 15, 200, true, &(SEN6X_data.temp)); 
-        process_data(rx_buffer + 18, 10, true, &(SEN6X_data.VOC)); 
-        process_data(rx_buffer + 21, 10, true, &(SEN6X_data.NOx)); 
-        process_data(rx_buffer + 24, 1, false, &(SEN6X_data.CO2)); 
-    
-    
-    #elif SEN_DEVICE_USED == SEN68
-        process_data(rx_buffer + 0, 10, false, &(SEN6X_data.PM_1_0)); 
-        process_data(rx_buffer + 3, 10, false, &(SEN6X_data.PM_2_5)); 
-        process_data(rx_buffer + 6, 10, false, &(SEN6X_data.PM_4_0)); 
-        process_data(rx_buffer + 9, 10, false, &(SEN6X_data.PM_10_0));
-
-        process_data(rx_buffer + 12, 100, true, &(SEN6X_data.humidity)); 
-        process_data(rx_buffer + 15, 200, true, &(SEN6X_data.temp)); 
-        process_data(rx_buffer + 18, 10, true, &(SEN6X_data.VOC)); 
-        process_data(rx_buffer + 21, 10, true, &(SEN6X_data.NOx)); 
-        process_data(rx_buffer + 24, 10, false, &(SEN6X_data.HCHO)); 
-    
-    #endif
-    
-    last_command_executed = 0; 
-    curr_state = SEN6X_WAIT_DATA_W; 
+    SEN6X_diag.stale_count += 1; 
+    SEN6X_start_recovery(); 
+    return; 
+}
+
+
+static void SEN6X_start_recovery(void)
+{
+    uint32_t i; 
+    
+    // Don't let the consumers use the last values as if they were current. 
+    for (i = 0; i < SEN6X_model->field_count; i += 1)
+        SEN6X_model->fields[i].dest->is_valid = false; 
+    
+    SEN6X_publish(); 
+    is_measuring = false; 
+    curr_state   = SEN6X_RECOVER; 
+    return; 
+}
+
+
+static void SEN6X_publish(void)
+{
+    back_buffer.sequence     = SEN6X_data.sequence + 1; 
+    back_buffer.timestamp_ms = SYSTICK_millis(); 
+    SEN6X_data               = back_buffer; 
     return; 
 }
 
 
 //* _ UTILITY FUNCTIONS ________________________________________________________
 
-static void SEN6X_data_init(SEN6X_DATA_t* data)
+static void SEN6X_data_init(SEN6X_DATA_t* data, const SEN6X_MODEL_t* model)
 {
     uint32_t i; 
     
@@ -288,20 +699,109 @@ static void SEN6X_data_init(SEN6X_DATA_t* data)
     for (i = 0; i < SEN6X_RX_BUF_LENGTH; i += 1)
         rx_buffer[i] = 0; 
 
-    data->PM_1_0   = 0; 
-    data->PM_2_5   = 0; 
-    data->PM_4_0   = 0; 
-    data->humidity = 0; 
-    data->temp     = 0; 
-    data->VOC      = 0; 
-    data->NOx      = 0; 
-    data->CO2      = 0; 
-    data->HCHO     = 0; 
+    data->PM_0_5   = (MEASUREMENT_t){.raw = 0, .divider = 1}; 
+    data->PM_1_0   = (MEASUREMENT_t){.raw = 0, .divider = 1}; 
+    data->PM_2_5   = (MEASUREMENT_t){.raw = 0, .divider = 1}; 
+    data->PM_4_0   = (MEASUREMENT_t){.raw = 0, .divider = 1}; 
+    data->PM_10_0  = (MEASUREMENT_t){.raw = 0, .divider = 1}; 
+    data->humidity = (MEASUREMENT_t){.raw = 0, .divider = 1}; 
+    data->temp     = (MEASUREMENT_t){.raw = 0, .divider = 1}; 
+    data->VOC      = (MEASUREMENT_t){.raw = 0, .divider = 1}; 
+    data->NOx      = (MEASUREMENT_t){.raw = 0, .divider = 1}; 
+    data->CO2      = (MEASUREMENT_t){.raw = 0, .divider = 1}; 
+    data->HCHO     = (MEASUREMENT_t){.raw = 0, .divider = 1}; 
+    
+    // Only the measurements of the model frame are provided. 
+    for (i = 0; i < model->field_count; i += 1)
+    {
+        model->fields[i].dest->divider      = model->fields[i].divider; 
+        model->fields[i].dest->is_available = true; 
+    }
+    
     return; 
 }
 
 
-static uint16_t get_command_wait_time(uint16_t command)
+static const SEN6X_MODEL_t* SEN6X_match_product_name(const uint8_t* frame)
+{
+    char        name[SEN6X_PRODUCT_NAME_LENGTH + 1]; 
+    uint32_t    i; 
+    
+    // The name is sent as words of 2 characters + CRC. 
+    if (crc_8_bad_words(frame, SEN6X_PRODUCT_NAME_LENGTH / 2) != 0)
+        return NULL; 
+    
+    for (i = 0; i < SEN6X_PRODUCT_NAME_LENGTH / 2; i += 1)
+    {
+        name[2 * i]     = frame[i * SEN6X_WORD_LENGTH]; 
+        name[2 * i + 1] = frame[i * SEN6X_WORD_LENGTH + 1]; 
+    }
+    
+    name[SEN6X_PRODUCT_NAME_LENGTH] = '\0'; 
+    for (i = 0; i < SEN6X_MODEL_COUNT; i += 1)
+    {
+        if (strcmp(name, SEN6X_MODEL_LUT[i].name) == 0)
+            return &SEN6X_MODEL_LUT[i]; 
+    }
+    
+    return NULL; 
+}
+
+
+static bool SEN6X_submit_command(const SEN6X_MODEL_t* model, SEN6X_COMMAND_t command, uint8_t rx_length)
+{
+    I2C_TRANSACTION_t transaction = {
+        .addr       = model->addr, 
+        .type       = rx_length ? I2C_WRITE_READ : I2C_WRITE, 
+        .tx_data    = {
+            (uint8_t)(model->commands[command] >> 8), 
+            (uint8_t)(model->commands[command] & 0xFF), 
+        }, 
+        .tx_length  = SEN6X_COMMAND_LENGTH, 
+        .rx_data    = rx_buffer, 
+        .rx_length  = rx_length, 
+        .delay_ms   = get_command_wait_time(command), 
+        .callback   = SEN6X_command_callback, 
+        .context    = (uintptr_t)command, 
+    }; 
+    
+    return I2C_submit(&transaction); 
+}
+
+
+static bool SEN6X_submit_request(const SEN6X_REQUEST_t* request)
+{
+    uint8_t*    arg; 
+    uint32_t    i; 
+    I2C_TRANSACTION_t transaction = {
+        .addr       = SEN6X_model->addr, 
+        .type       = request->rx_words ? I2C_WRITE_READ : I2C_WRITE, 
+        .tx_data    = {
+            (uint8_t)(SEN6X_model->commands[request->command] >> 8), 
+            (uint8_t)(SEN6X_model->commands[request->command] & 0xFF), 
+        }, 
+        .tx_length  = SEN6X_COMMAND_LENGTH + request->arg_count * SEN6X_WORD_LENGTH, 
+        .rx_data    = request_rx_buffer, 
+        .rx_length  = request->rx_words * SEN6X_WORD_LENGTH, 
+        .delay_ms   = request->wait_ms, 
+        .callback   = SEN6X_request_callback, 
+        .context    = (uintptr_t)NULL, 
+    }; 
+    
+    // Each argument word is followed by its CRC, like the answers. 
+    for (i = 0; i < request->arg_count; i += 1)
+    {
+        arg    = &transaction.tx_data[SEN6X_COMMAND_LENGTH + i * SEN6X_WORD_LENGTH]; 
+        arg[0] = (uint8_t)(request->args[i] >> 8); 
+        arg[1] = (uint8_t)(request->args[i] & 0xFF); 
+        arg[2] = crc_8_check(arg, 2); 
+    }
+    
+    return I2C_submit(&transaction); 
+}
+
+
+static uint16_t get_command_wait_time(SEN6X_COMMAND_t command)
 {
     uint16_t wait_time; 
     
@@ -322,40 +822,89 @@ static uint16_t get_command_wait_time(uint16_t command)
             
         case GET_DATA_READY: 
         case READ_MEASURED: 
+        case GET_PRODUCT_NAME: 
+        case READ_RAW_VALUES: 
+        case READ_NUMBER_CONCENTRATION: 
+        case GET_SERIAL_NUMBER: 
             wait_time = DEVICE_READ_WAIT_TIME; 
             break; 
+            
+        case SET_TEMPERATURE_OFFSET: 
+            wait_time = DEVICE_WRITE_WAIT_TIME; 
+            break; 
+            
+        case FORCED_CO2_RECALIBRATION: 
+            wait_time = DEVICE_FRC_WAIT_TIME; 
+            break; 
+            
+        // The fan runs for 10 s, the measurement can't be restarted before. 
+        case START_FAN_CLEANING: 
+            wait_time = DEVICE_FAN_CLEANING_WAIT_TIME; 
+            break; 
+            
+        default: 
+            break; 
     }
     
     return wait_time + WAIT_TIME_SAFETY_MS; 
 }
 
 
-static void process_data(uint8_t* src, float divider, bool is_signed, float* dest)
+static bool command_needs_idle(SEN6X_COMMAND_t command)
 {
-    uint8_t     calculated_crc; 
-    uint16_t    raw_data;
-    
-    // Check the CRC provided by the sensor to validate data integrity. 
-    calculated_crc = crc_8_check(src, 3); 
-    if (calculated_crc != 0)
-        return; 
-    
-    // Calculate the two bytes data. 
-    raw_data = (src[0] << 8 | src[1]); 
-    
-    // Check if the sensor sent relevant data. 
-    if (!is_signed && raw_data == UINT_16_UNKNOWN_VAL)
-        return; 
-    
-    else if (is_signed && raw_data == INT_16_UNKNOWN_VAL)
-        return; 
+    return command == START_FAN_CLEANING || command == FORCED_CO2_RECALIBRATION; 
+}
+
+
+static void decode_frame(const uint8_t* frame, uint32_t length, const SEN6X_FIELD_t* fields, uint32_t field_count)
+{
+    const SEN6X_FIELD_t*    field; 
+    const uint8_t*          word; 
+    uint32_t                bad_words; 
+    uint32_t                i; 
+    uint16_t                raw_data; 
+    bool                    has_unknown; 
+    
+    // Check the CRC of every word of the frame once to validate data 
+    // integrity, each corrupted word sets its bit. 
+    bad_words   = crc_8_bad_words(frame, length / SEN6X_WORD_LENGTH); 
+    has_unknown = false; 
+    if (bad_words)
+        SEN6X_diag.crc_count += 1; 
+    
+    for (i = 0; i < field_count; i += 1)
+    {
+        field = &fields[i]; 
+        field->dest->is_valid = false; 
+        if (bad_words & (1UL << field->word))
+            continue; 
+        
+        // Calculate the two bytes data. 
+        word     = &frame[field->word * SEN6X_WORD_LENGTH]; 
+        raw_data = (word[0] << 8 | word[1]); 
+        
+        // Check if the sensor sent relevant data. 
+        if ((!field->is_signed && raw_data == UINT_16_UNKNOWN_VAL) || 
+            (field->is_signed && raw_data == INT_16_UNKNOWN_VAL))
+        {
+            has_unknown = true; 
+            continue; 
+        }
+        
+        // Saves data to the correct location, the value stays in sensor ticks 
+        // along with its scale. 
+        if (field->is_signed)
+            field->dest->raw = (int16_t)raw_data; 
+        
+        else
+            field->dest->raw = raw_data; 
+        
+        field->dest->divider  = field->divider; 
+        field->dest->is_valid = true; 
+    }
     
-    // Saves data to the correct location. 
-    if (is_signed)
-        *dest = (int16_t)raw_data / divider; 
+    if (has_unknown)
+        SEN6X_diag.unknown_count += 1; 
     
-    else
-        *dest = (uint16_t)raw_data / divider; 
-        
     return; 
 }
\ No newline at end of file
@@ -6,29 +6,31 @@
 #include "definitions.h" 
 
 #include "../cores/systick.h"
+#include "../cores/i2c.h"
 #include "../utils/utils.h"
 
 
 //* _ DEFINITIONS ______________________________________________________________
 
-#define SEN60                           100
-#define SEN63C                          101
-#define SEN65                           102
-#define SEN66                           103
-#define SEN68                           104
-
-/// @define SEN_DEVICE_USED
-/// @brief this defines the SEN device used. Multiple options are available:
+/// @define SEN_DEVICE_DEFAULT
+/// @brief the SEN device is detected at startup, this one is used if the 
+///        detection fails. Multiple options are available:
 ///         - SEN60  -> PM sensor. 
 ///         - SEN63C -> PM, RH, T and CO2 sensor. 
 ///         - SEN65  -> PM, RH, T, VOC and NOx sensor. 
 ///         - SEN66  -> PM, RH, T, CO2, VOC and NOx sensor.
 ///         - SEN68  -> PM, RH, T, VOC, NOx and HCHO sensor. 
-#define SEN_DEVICE_USED                 SEN66
+#define SEN_DEVICE_DEFAULT              SEN66
 
 // Buffer configuration. 
 #define SEN6X_RX_BUF_LENGTH             32
 #define SEN6X_COMMAND_LENGTH            2
+#define SEN6X_PRODUCT_NAME_LENGTH       8
+
+// Command queue, the requests are run between two data ready polls. 
+#define SEN6X_REQUEST_QUEUE_LENGTH      4
+#define SEN6X_REQUEST_MAX_ARGS          4
+#define SEN6X_REQUEST_MAX_WORDS         16          // Serial number, 32 characters.
 
 // Initialization. 
 #define SEN6X_INIT_CONFIG               X(STOP_MEASUREMENT) \
@@ -39,37 +41,33 @@
 #define DEVICE_START_WAIT_TIME          50
 #define DEVICE_STOP_WAIT_TIME           1000
 #define DEVICE_READ_WAIT_TIME           20
+#define DEVICE_WRITE_WAIT_TIME          20
+#define DEVICE_FRC_WAIT_TIME            500
+#define DEVICE_FAN_CLEANING_WAIT_TIME   10000
+
+// Fault handling, the bus is recovered and the sensor reset after too many 
+// failed commands in a row or when no sample arrived for too long. 
+#define SEN6X_MAX_CONSECUTIVE_ERRORS    5
+#define SEN6X_STALE_TIMEOUT_MS          5000
+
+// Error counters: field of SEN6X_DIAG_t, label on the diagnostics page and 
+// key in the telemetry payload. 
+#define SEN6X_DIAG_COUNTERS             X(nack_count,       "NACK",     "nack")     \
+                                        X(timeout_count,    "TIMEOUT",  "timeout")  \
+                                        X(bus_error_count,  "BUS",      "bus")      \
+                                        X(crc_count,        "CRC",      "crc")      \
+                                        X(unknown_count,    "UNKNOWN",  "unknown")  \
+                                        X(stale_count,      "STALE",    "stale")    \
+                                        X(recovery_count,   "RECOVERY", "recovery")
 
 // Constant. 
 #define UINT_16_UNKNOWN_VAL             0xFFFF
 #define INT_16_UNKNOWN_VAL              0x7FFF
+#define SEN6X_WORD_LENGTH               CRC_8_WORD_LENGTH
 
-
-// Device specific configuration. 
-#if SEN_DEVICE_USED == SEN60
-    #define SEN6X_ADDR                  0x6C
-    #define SEN6X_MEASUREMENT_LENGTH    15
-
-#elif SEN_DEVICE_USED == SEN63C
-    #define SEN6X_ADDR                  0x6B
-    #define SEN6X_MEASUREMENT_LENGTH    21
-
-#elif SEN_DEVICE_USED == SEN65
-    #define SEN6X_ADDR              0x6B
-    #define SEN6X_MEASUREMENT_LENGTH    24
-
-#elif SEN_DEVICE_USED == SEN66
-    #define SEN6X_ADDR              0x6B
-    #define SEN6X_MEASUREMENT_LENGTH    27
-
-#elif SEN_DEVICE_USED == SEN68
-    #define SEN6X_ADDR              0x6B
-    #define SEN6X_MEASUREMENT_LENGTH    27
-
-#else
-    #error "~[ERR: DEVICE SELECTION] No SENx sensor selected."
-
-#endif
+// I²C addresses, the SEN60 is the only model on its own address. 
+#define SEN6X_ADDR                      0x6B
+#define SEN60_ADDR                      0x6C
 
 
 //* _ ENUMERATIONS _____________________________________________________________
@@ -78,82 +76,184 @@
 /// @brief enumerate all available states of the SEN6x state machine. 
 typedef enum sen6x_states
 {
+    SEN6X_DETECT, 
+    SEN6X_DETECT_SEN60, 
+    SEN6X_CONFIG, 
     SEN6X_IDLE,
     SEN6X_MEASUREMENT,
-    SEN6X_WAIT_DATA_W,
-    SEN6X_WAIT_DATA_R,
-    SEN6X_READ_DATA_W, 
-    SEN6X_READ_DATA_R, 
+    SEN6X_WAIT_DATA,
+    SEN6X_READ_DATA, 
     SEN6X_PARSE_DATA, 
+    SEN6X_REQUEST,          ///< Running the oldest queued request. 
+    SEN6X_BUSY,             ///< Waiting for the I²C transaction callback. 
+    SEN6X_RECOVER,          ///< Waiting for the I²C engine to be idle to recover the bus. 
 }   SEN6X_STATES_t;
 
 
+/// @enum SEN6X_MODEL_ID_t
+/// @brief enumerate all supported SEN6x models. 
+typedef enum sen6x_model_id
+{
+    SEN60, 
+    SEN63C, 
+    SEN65, 
+    SEN66, 
+    SEN68, 
+    SEN6X_MODEL_COUNT, 
+}   SEN6X_MODEL_ID_t;
+
+
 /// @enum SEN6X_COMMAND_t
-/// @brief enumerate available commands to operate the SEN6x sensor. 
+/// @brief enumerate available commands to operate the SEN6x sensor, the 
+///        command codes depend on the model. 
 typedef enum sen6x_command
 {
-    #if SEN_DEVICE_USED == SEN60
-        DEVICE_RESET            = 0x3F8D, 
-        START_MEASUREMENT       = 0x2152, 
-        STOP_MEASUREMENT        = 0x3F86, 
-        GET_DATA_READY          = 0xE4B8,
-    #else
-        DEVICE_RESET            = 0xD304, 
-        START_MEASUREMENT       = 0x0021, 
-        STOP_MEASUREMENT        = 0x0104, 
-        GET_DATA_READY          = 0x0202,
-    #endif
-            
-    #if SEN_DEVICE_USED == SEN60
-        READ_MEASURED       = 0xEC05, 
-        
-    #elif SEN_DEVICE_USED == SEN63C
-        READ_MEASURED       = 0x0471, 
-        
-    #elif SEN_DEVICE_USED == SEN65
-        READ_MEASURED       = 0x0446, 
-        
-    #elif SEN_DEVICE_USED == SEN66
-        READ_MEASURED       = 0x0300, 
-        
-    #elif SEN_DEVICE_USED == SEN68
-        READ_MEASURED       = 0x0767, 
-        
-    #endif
+    NO_COMMAND, 
+    DEVICE_RESET, 
+    START_MEASUREMENT, 
+    STOP_MEASUREMENT, 
+    GET_DATA_READY, 
+    READ_MEASURED, 
+    GET_PRODUCT_NAME, 
+    READ_RAW_VALUES, 
+    READ_NUMBER_CONCENTRATION, 
+    START_FAN_CLEANING,         ///< Idle mode only. 
+    SET_TEMPERATURE_OFFSET, 
+    FORCED_CO2_RECALIBRATION,   ///< Idle mode only. 
+    GET_SERIAL_NUMBER, 
+    SEN6X_COMMAND_COUNT, 
 }   SEN6X_COMMAND_t;
 
 
 //* _ STRUCTURE DEFINITIONS ____________________________________________________
 
+/// @struct SEN6X_DATA_t
+/// @brief one sample of the sensor. SEN6X_data is only updated as a whole 
+///        once a frame is decoded, consumers compare the sequence number to 
+///        skip work when no new sample arrived. 
 typedef struct sen6x_data
 {
-    float PM_0_5; 
-    float PM_1_0; 
-    float PM_2_5; 
-    float PM_4_0; 
-    float PM_10_0;
-    float humidity; 
-    float temp;
-    float VOC;
-    float NOx;
-    float CO2; 
-    float HCHO; 
+    MEASUREMENT_t PM_0_5; 
+    MEASUREMENT_t PM_1_0; 
+    MEASUREMENT_t PM_2_5; 
+    MEASUREMENT_t PM_4_0; 
+    MEASUREMENT_t PM_10_0;
+    MEASUREMENT_t humidity; 
+    MEASUREMENT_t temp;
+    MEASUREMENT_t VOC;
+    MEASUREMENT_t NOx;
+    MEASUREMENT_t CO2; 
+    MEASUREMENT_t HCHO; 
+    uint32_t      sequence;     ///< Incremented on each sample, 0 before the first one. 
+    uint32_t      timestamp_ms; ///< Capture time of the sample. 
 }   SEN6X_DATA_t;
 
 
+/// @struct SEN6X_DIAG_t
+/// @brief error counters since boot, shown on the diagnostics page and 
+///        published with the measurements. 
+typedef struct sen6x_diag
+{
+    uint32_t nack_count;        ///< Commands not acknowledged by the sensor. 
+    uint32_t timeout_count;     ///< Transfers that didn't end, SCL or SDA held low. 
+    uint32_t bus_error_count;   ///< Bus errors and lost arbitrations. 
+    uint32_t crc_count;         ///< Answers with at least one corrupted word. 
+    uint32_t unknown_count;     ///< Frames with at least one field at its unknown value. 
+    uint32_t stale_count;       ///< No sample for SEN6X_STALE_TIMEOUT_MS. 
+    uint32_t recovery_count;    ///< Bus recoveries followed by a sensor reset. 
+}   SEN6X_DIAG_t;
+
+
+/// @struct SEN6X_FIELD_t
+/// @brief describes one measurement word of the READ_MEASURED frame. 
+typedef struct sen6x_field
+{
+    uint8_t         word;       ///< Index of the word (2 bytes + CRC) in the frame. 
+    uint16_t        divider;    ///< Ticks per unit of the measurement. 
+    bool            is_signed;  ///< The word is an int16, unsigned otherwise. 
+    MEASUREMENT_t*  dest;       ///< Measurement updated with the word. 
+}   SEN6X_FIELD_t;
+
+
+/// @struct SEN6X_MODEL_t
+/// @brief everything that differs from one SEN6x model to another. 
+typedef struct sen6x_model
+{
+    const char              name[SEN6X_PRODUCT_NAME_LENGTH + 1];    ///< Product name reported by the sensor. 
+    uint8_t                 addr;                                   ///< I²C address. 
+    uint16_t                commands[SEN6X_COMMAND_COUNT];          ///< Command codes, 0 if not supported. 
+    uint8_t                 measurement_length;                     ///< Length of the READ_MEASURED frame. 
+    const SEN6X_FIELD_t*    fields;                                 ///< Layout of the READ_MEASURED frame. 
+    uint8_t                 field_count; 
+}   SEN6X_MODEL_t;
+
+
+/// @typedef SEN6X_REQUEST_CALLBACK_t 
+/// @brief called once a request is over, from the main loop context. 
+/// @param is_success the sensor acknowledged the command and its answer is 
+///                   not corrupted. 
+/// @param words answer of the sensor without the CRCs. 
+/// @param word_count number of words, 0 on failure. 
+/// @param context value given with the request. 
+typedef void (*SEN6X_REQUEST_CALLBACK_t)(bool is_success, const uint16_t* words, uint32_t word_count, uintptr_t context); 
+
+
+/// @struct SEN6X_REQUEST_t
+/// @brief queued command, run between two samples without stopping the 
+///        measurement. Idle mode commands stop it and restart it afterward. 
+typedef struct sen6x_request
+{
+    SEN6X_COMMAND_t             command; 
+    uint16_t                    args[SEN6X_REQUEST_MAX_ARGS];   ///< Argument words, the CRCs are added on submit. 
+    uint8_t                     arg_count; 
+    uint8_t                     rx_words;                       ///< Length of the answer in words. 
+    uint16_t                    wait_ms;                        ///< Execution time waited before the answer or the next command. 
+    bool                        needs_idle;                     ///< The measurement is stopped around the command. 
+    SEN6X_REQUEST_CALLBACK_t    callback;                       ///< Can be NULL. 
+    uintptr_t                   context; 
+}   SEN6X_REQUEST_t;
+
+
 //* _ EXTERN VARIABLE DECLARATIONS _____________________________________________
 
-extern SEN6X_DATA_t SEN6X_data; 
+extern SEN6X_DATA_t            SEN6X_data; 
+extern SEN6X_DIAG_t            SEN6X_diag; 
+extern const SEN6X_MODEL_t*    SEN6X_model; 
 
 
 //* _ FUNCTION DECLARATIONS ____________________________________________________
 
 /// @fn void SEN6X_init(void); 
-/// @ brief initialize any SEN6x device. 
+/// @ brief restarts the detection of the connected SEN6x model and its 
+///         initialization, both are run by SEN6X_task. Only the measurements 
+///         provided by the model are marked available. 
 void SEN6X_init(void); 
 
+
+/// @fn bool SEN6X_is_ready(void); 
+/// @brief boot step, the model is detected and the measurement started. 
+bool SEN6X_is_ready(void); 
+
+
+/// @fn bool SEN6X_has_sample(void); 
+/// @brief boot step, a measurement frame has been received since init. 
+bool SEN6X_has_sample(void); 
+
+
+/// @fn bool SEN6X_request(SEN6X_COMMAND_t command, const uint16_t* args, uint8_t arg_count, uint8_t rx_words, SEN6X_REQUEST_CALLBACK_t callback, uintptr_t context); 
+/// @brief queues a command of the detected model, its callback is notified 
+///        once it is executed. The periodic measurement goes on, one request 
+///        is run after each data ready poll. 
+/// @param args argument words, can be NULL if arg_count is 0. 
+/// @param rx_words length of the answer in words, 0 if the command has none. 
+/// @return false if no model is detected, the model doesn't support the 
+///         command, the arguments or answer are too long or the queue is full. 
+bool SEN6X_request(SEN6X_COMMAND_t command, const uint16_t* args, uint8_t arg_count, uint8_t rx_words, SEN6X_REQUEST_CALLBACK_t callback, uintptr_t context); 
+
+
 /// @fn void SEN6X_task(void); 
-/// @brief maintains the sensor measurement reading state machine. 
+/// @brief maintains the sensor measurement reading state machine, recovers 
+///        the bus and resets the sensor when it stops answering. 
 void SEN6X_task(void); 
 
 
@@ -1,17 +1,49 @@
 #include "ssd1362.h"
 
 
-static PIXEL_INTENSITY_t    framebuffer[BUFFER_SIZE] = {0}; 
+//* _ GLOBAL VARIABLE DECLARATIONS _____________________________________________
+
+SSD1362_STATS_t SSD1362_stats = {0}; 
+
+
+//* _ STATIC VARIABLE DECLARATIONS _____________________________________________
+
+// Drawing functions always target the back buffer pointed by "framebuffer" 
+// while the DMA streams the front buffer, both are swapped on refresh. 
+static PIXEL_INTENSITY_t    framebuffers[FRAMEBUFFER_COUNT][BUFFER_SIZE] = {0}; 
+static PIXEL_INTENSITY_t*   framebuffer  = framebuffers[0]; 
+static PIXEL_INTENSITY_t*   front_buffer = framebuffers[1]; 
 
 static volatile SSD1362_STATES_t     curr_state = SSD1362_READY; 
+static bool                          refresh_requested = false; 
+static bool                          screen_is_synced  = false; 
 static volatile bool                 dma_transfert_finished = 1; 
 static uint32_t                      last_refresh_timestamp; 
 
+static DIRTY_AREA_t                  dirty_area    = {0}; 
+static DIRTY_AREA_t                  transfer_area = {0}; 
+static volatile uint32_t             transfer_row  = 0; 
+
+static GLYPH_t                       glyph_cache[GLYPH_CACHE_SIZE] = {0}; 
+static uint32_t                      glyph_cache_tick = 0; 
+
 static void DMAC_callback(DMAC_TRANSFER_EVENT status, uintptr_t context); 
+static void SSD1362_READY_state(void); 
 static void SSD1362_TRANSMIT_state(void); 
 static void SSD1362_END_TRANSFERT_state(void); 
 static void SSD1362_REFRESH_RATE_WAIT_state(void);
 
+static void SSD1362_swap_buffers(void); 
+static void SSD1362_set_window(const DIRTY_AREA_t* area); 
+static void SSD1362_transfer_next_block(void); 
+static void dirty_area_extend(uint32_t x0, uint32_t y0, uint32_t x1, uint32_t y1); 
+static bool dirty_area_trim(void); 
+static void display_fill_bytes(uint8_t* dest, uint8_t value, uint32_t count); 
+static void display_fill_span(uint32_t x, uint32_t y, uint32_t w, uint32_t h, uint8_t intensity); 
+static void display_blit(uint32_t x, uint32_t y, uint32_t w, uint32_t h, const uint8_t* img, uint8_t key); 
+static const GLYPH_t* glyph_cache_get(char c, const uint8_t* font_data); 
+static void glyph_transpose(GLYPH_t* glyph, char c, const uint8_t* font_data); 
+
 
 //* _ HARDWARE FUNCTIONS _______________________________________________________
 
@@ -51,6 +83,14 @@ static void DMAC_callback(DMAC_TRANSFER_EVENT status, uintptr_t context)
 {
     if (status == DMAC_TRANSFER_EVENT_COMPLETE) 
     {
+        // Chain the next rows of the window directly from the interrupt so the 
+        // SPI bus never idles between two blocks. 
+        if (transfer_row <= transfer_area.row_end)
+        {
+            SSD1362_transfer_next_block(); 
+            return; 
+        }
+        
         dma_transfert_finished = 1; 
         curr_state             = SSD1362_END_TRANSFERT; 
     }
@@ -64,7 +104,7 @@ void SSD1362_task(void)
     switch (curr_state)
     {
         case SSD1362_READY: 
-            // Wait for software trigger to send the current framebuffer. 
+            SSD1362_READY_state(); 
             break; 
             
         case SSD1362_TRANSMIT:
@@ -86,19 +126,54 @@ void SSD1362_task(void)
 }
 
 
+static void SSD1362_READY_state(void)
+{
+    // Wait for software trigger to send the current back buffer. 
+    if (!refresh_requested)
+        return; 
+    
+    refresh_requested = false; 
+    
+    // Nothing has been drawn since the last transfer, skip it. 
+    if (!dirty_area.is_dirty)
+    {
+        SSD1362_stats.frames_skipped += 1; 
+        return; 
+    }
+    
+    // The front buffer holds what is on screen, only keep the rows that really 
+    // changed. The screen RAM content is unknown until the first transfer. 
+    if (screen_is_synced && !dirty_area_trim())
+    {
+        dirty_area.is_dirty = false; 
+        SSD1362_stats.frames_skipped += 1; 
+        return; 
+    }
+    
+    SSD1362_swap_buffers(); 
+    screen_is_synced = true; 
+    
+    SSD1362_stats.frames_sent += 1; 
+    SSD1362_stats.bytes_sent  += (transfer_area.col_end - transfer_area.col_start + 1) 
+            * (transfer_area.row_end - transfer_area.row_start + 1); 
+    
+    curr_state = SSD1362_TRANSMIT; 
+    return; 
+}
+
+
 static void SSD1362_TRANSMIT_state(void)
 {
     if (!dma_transfert_finished)
         return; 
     
+    transfer_row = transfer_area.row_start; 
+    
     DISPLAY_CS_Clear(); 
+    SSD1362_set_window(&transfer_area); 
+    
     dma_transfert_finished = 0; 
-    DMAC_ChannelTransfer(
-        DMAC_CHANNEL_0, 
-        framebuffer, 
-        (const void*)&(SERCOM2_REGS->SPIM.SERCOM_DATA), 
-        BUFFER_SIZE
-    );
+    SSD1362_transfer_next_block(); 
     
     last_refresh_timestamp = SYSTICK_millis(); 
     curr_state = SSD1362_WAIT_TRANFERT; 
@@ -128,11 +203,122 @@ static void SSD1362_REFRESH_RATE_WAIT_state(void)
 }
 
 
+static void SSD1362_swap_buffers(void)
+{
+    PIXEL_INTENSITY_t*  swap; 
+    uint32_t            offset; 
+    uint32_t            width; 
+    uint32_t            row; 
+    
+    // Latch the area to send and start tracking the next frame. 
+    transfer_area       = dirty_area; 
+    dirty_area.is_dirty = false; 
+    
+    swap         = front_buffer; 
+    front_buffer = framebuffer; 
+    framebuffer  = swap; 
+    
+    // The new back buffer holds the frame before the one being sent, bring 
+    // the modified area up to date so drawing can go on incrementally. 
+    width = transfer_area.col_end - transfer_area.col_start + 1; 
+    for (row = transfer_area.row_start; row <= transfer_area.row_end; row += 1)
+    {
+        offset = transfer_area.col_start + row * DISPLAY_LOGICAL_WIDTH; 
+        memcpy(&framebuffer[offset], &front_buffer[offset], width); 
+    }
+    
+    return; 
+}
+
+
+static void SSD1362_set_window(const DIRTY_AREA_t* area)
+{
+    uint8_t command[SSD1362_WINDOW_CMD_SIZE]; 
+    
+    // Restrict the controller RAM write window to the given area, the 
+    // controller wraps to the next row of the window by itself. 
+    command[0] = SET_COL_ADDR; 
+    command[1] = area->col_start; 
+    command[2] = area->col_end; 
+    command[3] = SET_ROW_ADDR; 
+    command[4] = area->row_start; 
+    command[5] = area->row_end; 
+    
+    DISPLAY_DATA_Clear(); 
+    SERCOM2_SPI_Write(command, SSD1362_WINDOW_CMD_SIZE); 
+    while (SERCOM2_SPI_IsBusy()); 
+    DISPLAY_DATA_Set(); 
+    return; 
+}
+
+
+static void SSD1362_transfer_next_block(void)
+{
+    uint32_t width; 
+    uint32_t rows; 
+    
+    // Rows spanning the whole display width are contiguous in the framebuffer 
+    // and can be sent in one block, otherwise send the window row by row. 
+    width = transfer_area.col_end - transfer_area.col_start + 1; 
+    rows  = (width == DISPLAY_LOGICAL_WIDTH) ? 
+                (transfer_area.row_end - transfer_row + 1) : 1; 
+    
+    DMAC_ChannelTransfer(
+        DMAC_CHANNEL_0, 
+        &front_buffer[transfer_area.col_start + transfer_row * DISPLAY_LOGICAL_WIDTH], 
+        (const void*)&(SERCOM2_REGS->SPIM.SERCOM_DATA), 
+        width * rows
+    );
+    
+    transfer_row += rows; 
+    return; 
+}
+
+
+static void dirty_area_extend(uint32_t x0, uint32_t y0, uint32_t x1, uint32_t y1)
+{
+    uint32_t col_start; 
+    uint32_t col_end; 
+    
+    // Coordinates are given in pixels and already clipped to the screen, 
+    // convert them to controller columns. 
+    col_start = x0 / (8 / BIT_PER_PIXEL); 
+    col_end   = x1 / (8 / BIT_PER_PIXEL); 
+    
+    if (!dirty_area.is_dirty)
+    {
+        dirty_area.is_dirty  = true; 
+        dirty_area.col_start = col_start; 
+        dirty_area.col_end   = col_end; 
+        dirty_area.row_start = y0; 
+        dirty_area.row_end   = y1; 
+        return; 
+    }
+    
+    if (col_start < dirty_area.col_start)
+        dirty_area.col_start = col_start; 
+    
+    if (col_end > dirty_area.col_end)
+        dirty_area.col_end = col_end; 
+    
+    if (y0 < dirty_area.row_start)
+        dirty_area.row_start = y0; 
+    
+    if (y1 > dirty_area.row_end)
+        dirty_area.row_end = y1; 
+    
+    return; 
+}
+
 
 void SSD1362_refresh(void)
 {
+    // Swap the buffers right away if the front buffer is not being sent, 
+    // otherwise the swap is done by the state machine once it is released. 
+    refresh_requested = true; 
+    
     if (curr_state == SSD1362_READY)
-        curr_state = SSD1362_TRANSMIT;
+        SSD1362_READY_state(); 
 
     return; 
 }
@@ -141,15 +327,15 @@ void SSD1362_refresh(void)
 
 void display_fill(uint8_t intensity)
 {
-    int i; 
-    
-    if (curr_state != SSD1362_READY)
-        return; 
-    
-    // Fill the framebuffer of the given intensity. 
-    for (i = 0; i < BUFFER_SIZE; i += 1)
-        framebuffer[i].intensity = (intensity << BIT_PER_PIXEL) | intensity; 
+    // Fill the framebuffer of the given intensity, full rows are contiguous so 
+    // the whole buffer is filled in one pass. 
+    display_fill_bytes(
+        (uint8_t*)framebuffer, 
+        (intensity << BIT_PER_PIXEL) | intensity, 
+        BUFFER_SIZE
+    ); 
     
+    dirty_area_extend(0, 0, DISPLAY_WIDTH - 1, DISPLAY_HEIGHT - 1); 
     return; 
 }
 
@@ -160,9 +346,6 @@ void display_set_pixel(uint32_t x, uint32_t y, uint8_t intensity)
     if (COORD_ISINVALID(x, y))
         return; 
     
-    else if (curr_state != SSD1362_READY)
-        return; 
-    
     // Set the correct half of the byte depending on the x position (each byte 
     // correspond to two pixels).
     if (x % 2 == 0)
@@ -170,29 +353,22 @@ void display_set_pixel(uint32_t x, uint32_t y, uint8_t intensity)
     else
         framebuffer[x / (8 / BIT_PER_PIXEL) + y * DISPLAY_LOGICAL_WIDTH].second_pixel = intensity; 
     
+    dirty_area_extend(x, y, x, y); 
     return; 
 }
 
 void display_fast_h_line(uint32_t x, uint32_t y, uint32_t w, uint8_t intensity)
 {
-    uint32_t i; 
-
-    // Trace point on an horizontal line, skipping Bresenham's line algorithm. 
-    for (i = 0; i < w; i++)
-        display_set_pixel(x + i, y, intensity); 
-
+    // Fill a one pixel high span, skipping Bresenham's line algorithm. 
+    display_fill_span(x, y, w, 1, intensity); 
     return; 
 }
 
 
 void display_fast_v_line(uint32_t x, uint32_t y, uint32_t h, uint8_t intensity)
 {
-    uint32_t i; 
-
-    // Trace point on a vertical line, skipping Bresenham's line algorithm.  
-    for (i = 0; i < h; i++)
-        display_set_pixel(x, y + i, intensity); 
-
+    // Fill a one pixel wide span, skipping Bresenham's line algorithm.  
+    display_fill_span(x, y, 1, h, intensity); 
     return; 
 }
 
@@ -367,64 +543,82 @@ void display_draw_rounded_rect(uint32_t x, uint32_t y, uint32_t w, uint32_t h, u
 
 void display_draw_fillrect(uint32_t x, uint32_t y, uint32_t w, uint32_t h, uint8_t intensity)
 {
-    uint32_t i; 
-
-    // Draw horizontal lines for the height of the rectangle. 
-    for (i = 0; i < h; i++)
-        display_fast_h_line(x, y + i, w, intensity); 
-
+    display_fill_span(x, y, w, h, intensity); 
     return; 
 }
 
 void display_draw_char(uint32_t x, uint32_t y, char c, uint8_t fg_intensity, const uint8_t* font_data)
 {
-    const uint8_t*  char_addr; 
-    uint8_t         font_height; 
-    uint8_t         font_width;
-    uint8_t         font_ascii_offset; 
-    uint8_t         bytes_per_col; 
-    uint16_t        current_pixel; 
+    const GLYPH_t*      glyph; 
+    PIXEL_INTENSITY_t*  dest; 
+    const uint8_t*      src; 
+    uint8_t             fill; 
+    uint8_t             mask; 
+    uint8_t             prev_mask; 
+    uint32_t            shift; 
+    uint32_t            dest_bytes; 
+    uint32_t            rows; 
+    uint32_t            i; 
+    uint32_t            j; 
     
     if (!font_data)
         return; 
     
-    else if (curr_state != SSD1362_READY)
+    else if (COORD_ISINVALID(x, y))
+        return; 
+    
+    glyph = glyph_cache_get(c, font_data); 
+    if (!glyph)
         return; 
     
-    // Get font information from font header. 
-    font_width        = font_data[HEADER_FONT_WIDTH]; 
-    font_height       = font_data[HEADER_FONT_HEIGHT]; 
-    font_ascii_offset = font_data[HEADER_FONT_OFFSET]; 
+    // An odd x shifts the glyph by one nibble, so each row covers one more 
+    // byte of the framebuffer. Clip the glyph to the screen once. 
+    shift      = x % 2; 
+    dest_bytes = (shift + glyph->width + 1) / (8 / BIT_PER_PIXEL); 
+    rows       = glyph->height; 
+    
+    if (dest_bytes > DISPLAY_LOGICAL_WIDTH - x / (8 / BIT_PER_PIXEL))
+        dest_bytes = DISPLAY_LOGICAL_WIDTH - x / (8 / BIT_PER_PIXEL); 
     
-    bytes_per_col = (font_height > sizeof(uint8_t) * 8) ? 2 : 1; 
+    if (rows > DISPLAY_HEIGHT - y)
+        rows = DISPLAY_HEIGHT - y; 
     
-    // Get the address of the character we want to print from the font array. 
-    char_addr = font_data + (FONT_HEADER_SIZE + (c - font_ascii_offset) * font_width * bytes_per_col); 
+    fill = (fg_intensity & 0x0F) * 0x11; 
+    dest = &framebuffer[x / (8 / BIT_PER_PIXEL) + y * DISPLAY_LOGICAL_WIDTH]; 
     
-    for (int i = 0; i < font_width; i += 1)
+    for (j = 0; j < rows; j += 1)
     {
-        // Get the raw byte to operate on it. 
-        if (bytes_per_col == 1)
-            current_pixel = *char_addr;
-        else
-            current_pixel = (char_addr[1] << 8) | char_addr[0]; 
+        src = glyph->mask[j]; 
         
-        // Loop through each bit and set the pixel as foreground intensity if it
-        // is high, background intensity if it is low. 
-        for (int j = 0; j < font_height; j += 1)
+        // Even x, the glyph bytes match the framebuffer bytes. 
+        if (!shift)
         {
-            if (current_pixel & 0x01)
-                display_set_pixel(x + i, y + j, fg_intensity); 
-            
-            // Offset the byte by one to see the next bit. 
-            current_pixel = current_pixel >> 1; 
+            for (i = 0; i < dest_bytes; i += 1)
+                dest[i].intensity = (dest[i].intensity & ~src[i]) | (fill & src[i]); 
         }
         
-        // Increment the character address to get the next byte that form the 
-        // character. 
-        char_addr += bytes_per_col; 
+        // Odd x, build each mask from the two glyph bytes it overlaps. 
+        else
+        {
+            prev_mask = 0; 
+            for (i = 0; i < dest_bytes; i += 1)
+            {
+                mask = (i < GLYPH_MAX_ROW_BYTES) ? src[i] : 0; 
+                dest[i].intensity = (dest[i].intensity & ~((prev_mask << 4) | (mask >> 4))) 
+                        | (fill & ((prev_mask << 4) | (mask >> 4))); 
+                prev_mask = mask; 
+            }
+        }
+        
+        dest += DISPLAY_LOGICAL_WIDTH; 
     }
     
+    dirty_area_extend(
+        x, 
+        y, 
+        (x + glyph->width - 1 < DISPLAY_WIDTH) ? x + glyph->width - 1 : DISPLAY_WIDTH - 1, 
+        y + rows - 1
+    ); 
     return; 
 }
 
@@ -517,23 +711,376 @@ uint32_t display_printf(uint32_t x, uint32_t y, uint8_t fg_intensity, FONTS_t fo
 
 void display_img(uint32_t x, uint32_t y, uint32_t w, uint32_t h, const uint8_t* img)
 {
-    int x_index; 
-    int y_index; 
-    uint8_t curr_pixel; 
+    display_blit(x, y, w, h, img, IMG_OPAQUE); 
+    return;
+}
+
+
+void display_img_transparent(uint32_t x, uint32_t y, uint32_t w, uint32_t h, const uint8_t* img, uint8_t key)
+{
+    display_blit(x, y, w, h, img, key & 0x0F); 
+    return; 
+}
+
+
+void display_img_rle(uint32_t x, uint32_t y, uint32_t w, uint32_t h, const uint8_t* img)
+{
+    uint32_t    col; 
+    uint32_t    row; 
+    uint32_t    count; 
+    uint32_t    run; 
+    uint32_t    i; 
+    uint8_t     token; 
+    uint8_t     intensity; 
     
-    if (curr_state != SSD1362_READY)
+    if (COORD_ISINVALID(x, y) || !w || !h)
         return; 
+    
+    // Rows are padded to whole bytes like raw images. 
+    w   = (w + 1) & ~1UL; 
+    col = 0; 
+    row = 0; 
+    
+    while (row < h)
+    {
+        token = *img++; 
+        count = (token & RLE_COUNT_MASK) + 1; 
+        
+        // Literal packet, pixels are copied one by one. 
+        if (token & RLE_LITERAL_FLAG)
+        {
+            for (i = 0; i < count && row < h; i += 1)
+            {
+                intensity = (i % 2) ? (img[i / 2] & 0x0F) : (img[i / 2] >> 4); 
+                
+                if (!COORD_ISINVALID(x + col, y + row))
+                {
+                    if ((x + col) % 2 == 0)
+                        framebuffer[(x + col) / (8 / BIT_PER_PIXEL) + (y + row) * DISPLAY_LOGICAL_WIDTH].first_pixel = intensity; 
+                    else
+                        framebuffer[(x + col) / (8 / BIT_PER_PIXEL) + (y + row) * DISPLAY_LOGICAL_WIDTH].second_pixel = intensity; 
+                }
+                
+                col += 1; 
+                if (col == w)
+                {
+                    col  = 0; 
+                    row += 1; 
+                }
+            }
+            img += (count + 1) / 2; 
+        }
+        
+        // Run packet, each row segment of the run is a span fill. 
+        else
+        {
+            intensity = *img++ & 0x0F; 
+            while (count && row < h)
+            {
+                run = (count < w - col) ? count : w - col; 
+                display_fill_span(x + col, y + row, run, 1, intensity); 
+                
+                count -= run; 
+                col   += run; 
+                if (col == w)
+                {
+                    col  = 0; 
+                    row += 1; 
+                }
+            }
+        }
+    }
+    
+    // Mark the visible part of the image as modified. 
+    dirty_area_extend(
+        x, 
+        y, 
+        (x + w - 1 < DISPLAY_WIDTH) ? x + w - 1 : DISPLAY_WIDTH - 1, 
+        (y + h - 1 < DISPLAY_HEIGHT) ? y + h - 1 : DISPLAY_HEIGHT - 1
+    ); 
+    return; 
+}
+
+
+//* _ UTILITY FUNCTIONS ________________________________________________________
+
+static bool dirty_area_trim(void)
+{
+    uint32_t offset; 
+    uint32_t width; 
+    
+    width = dirty_area.col_end - dirty_area.col_start + 1; 
+    
+    // Drop the top rows that match the frame on screen. 
+    while (dirty_area.row_start <= dirty_area.row_end)
+    {
+        offset = dirty_area.col_start + dirty_area.row_start * DISPLAY_LOGICAL_WIDTH; 
+        if (memcmp(&framebuffer[offset], &front_buffer[offset], width))
+            break; 
+        
+        dirty_area.row_start += 1; 
+    }
+    
+    // The whole area is identical, the frame does not need to be sent. 
+    if (dirty_area.row_start > dirty_area.row_end)
+        return false; 
+    
+    // Drop the bottom rows that match the frame on screen, at least one row 
+    // differs so this loop always ends. 
+    while (true)
+    {
+        offset = dirty_area.col_start + dirty_area.row_end * DISPLAY_LOGICAL_WIDTH; 
+        if (memcmp(&framebuffer[offset], &front_buffer[offset], width))
+            break; 
+        
+        dirty_area.row_end -= 1; 
+    }
+    
+    return true; 
+}
+
+
+static void display_fill_bytes(uint8_t* dest, uint8_t value, uint32_t count)
+{
+    uint32_t    word; 
+    uint32_t*   dest_word; 
+    
+    // Write single bytes until the destination is word aligned. 
+    while (count && ((uintptr_t)dest & (sizeof(uint32_t) - 1)))
+    {
+        *dest++ = value; 
+        count -= 1; 
+    }
+    
+    // Fill the aligned middle four bytes at a time. 
+    word      = value * 0x01010101UL; 
+    dest_word = (uint32_t*)dest; 
+    while (count >= sizeof(uint32_t))
+    {
+        *dest_word++ = word; 
+        count -= sizeof(uint32_t); 
+    }
+    
+    // Write the remaining bytes. 
+    dest = (uint8_t*)dest_word; 
+    while (count)
+    {
+        *dest++ = value; 
+        count -= 1; 
+    }
+    
+    return; 
+}
+
+
+static void display_fill_span(uint32_t x, uint32_t y, uint32_t w, uint32_t h, uint8_t intensity)
+{
+    PIXEL_INTENSITY_t*  row; 
+    uint32_t            x_end; 
+    uint32_t            col_start; 
+    uint32_t            col_end; 
+    uint32_t            i; 
+    
+    // Clip the rectangle to the screen boundaries once. 
+    if (COORD_ISINVALID(x, y) || !w || !h)
+        return; 
+    
+    if (w > DISPLAY_WIDTH - x)
+        w = DISPLAY_WIDTH - x; 
+    
+    if (h > DISPLAY_HEIGHT - y)
+        h = DISPLAY_HEIGHT - y; 
+    
+    intensity &= 0x0F; 
+    
+    // An odd starting x only covers the second pixel of its byte and an odd 
+    // ending x only the first pixel of its byte, whole bytes lie in between. 
+    x_end     = x + w; 
+    col_start = (x + 1) / (8 / BIT_PER_PIXEL); 
+    col_end   = x_end / (8 / BIT_PER_PIXEL); 
+    
+    row = &framebuffer[y * DISPLAY_LOGICAL_WIDTH]; 
+    for (i = 0; i < h; i += 1)
+    {
+        if (x % 2)
+            row[x / (8 / BIT_PER_PIXEL)].second_pixel = intensity; 
+        
+        if (x_end % 2)
+            row[x_end / (8 / BIT_PER_PIXEL)].first_pixel = intensity; 
+        
+        if (col_end > col_start)
+            display_fill_bytes(
+                (uint8_t*)&row[col_start], 
+                intensity * 0x11, 
+                col_end - col_start
+            ); 
+        
+        row += DISPLAY_LOGICAL_WIDTH; 
+    }
+    
+    dirty_area_extend(x, y, x_end - 1, y + h - 1); 
+    return; 
+}
 
-    for (y_index = 0; y_index < h; y_index += 1)
-        for (x_index = 0; x_index < (w + 1) / 2; x_index += 1)
+
+static void display_blit(uint32_t x, uint32_t y, uint32_t w, uint32_t h, const uint8_t* img, uint8_t key)
+{
+    const uint8_t*  src; 
+    uint8_t*        dest; 
+    uint32_t        stride; 
+    uint32_t        col_start; 
+    uint32_t        col_end; 
+    uint32_t        col; 
+    uint32_t        row; 
+    uint32_t        k; 
+    uint8_t         pixels; 
+    uint8_t         mask; 
+    
+    if (COORD_ISINVALID(x, y) || !w || !h)
+        return; 
+    
+    // Rows are stored padded to whole bytes and drawn with their padding. 
+    stride = (w + 1) / 2; 
+    w      = stride * 2; 
+    
+    // Clip the image to the screen boundaries once, hidden parts are never 
+    // read. 
+    if (w > DISPLAY_WIDTH - x)
+        w = DISPLAY_WIDTH - x; 
+    
+    if (h > DISPLAY_HEIGHT - y)
+        h = DISPLAY_HEIGHT - y; 
+    
+    col_start = x / (8 / BIT_PER_PIXEL); 
+    col_end   = (x + w - 1) / (8 / BIT_PER_PIXEL); 
+    
+    for (row = 0; row < h; row += 1)
+    {
+        src  = &img[row * stride]; 
+        dest = (uint8_t*)&framebuffer[(y + row) * DISPLAY_LOGICAL_WIDTH]; 
+        
+        // Byte aligned opaque rows are a plain copy. 
+        if (x % 2 == 0 && key == IMG_OPAQUE)
+        {
+            memcpy(&dest[col_start], src, col_end - col_start + 1); 
+            continue; 
+        }
+        
+        for (col = col_start; col <= col_end; col += 1)
         {
-            if (COORD_ISINVALID((x + (x_index * 2)), (y + y_index)))
-                continue; 
+            k = col - col_start; 
+            
+            // On an odd x, each screen byte takes the second pixel of a source 
+            // byte and the first pixel of the next one. The first and last 
+            // screen bytes are only half covered by the image. 
+            if (x % 2 == 0)
+            {
+                pixels = src[k]; 
+                mask   = 0xFF; 
+            }
+            else
+            {
+                pixels = ((k > 0) ? (src[k - 1] << 4) : 0) | ((k < stride) ? (src[k] >> 4) : 0); 
+                mask   = (k > 0) ? 0xFF : 0x0F; 
+                
+                if (k == stride)
+                    mask &= 0xF0; 
+            }
+            
+            // Pixels of the transparent intensity keep the screen content. 
+            if (key != IMG_OPAQUE)
+            {
+                if ((pixels >> 4) == key)
+                    mask &= 0x0F; 
+                
+                if ((pixels & 0x0F) == key)
+                    mask &= 0xF0; 
+            }
             
-            curr_pixel = img[x_index + y_index * ((w + 1) / 2)]; 
+            dest[col] = (dest[col] & ~mask) | (pixels & mask); 
+        }
+    }
+    
+    dirty_area_extend(x, y, x + w - 1, y + h - 1); 
+    return; 
+}
+
 
-            framebuffer[(x / 2 + x_index) + (y + y_index) * DISPLAY_LOGICAL_WIDTH].intensity = curr_pixel; 
+static const GLYPH_t* glyph_cache_get(char c, const uint8_t* font_data)
+{
+    GLYPH_t*    glyph; 
+    GLYPH_t*    oldest; 
+    uint32_t    i; 
+    
+    glyph_cache_tick += 1; 
+    
+    // Look for the glyph in the cache and remember the least recently used 
+    // slot in case it has to be converted. Free slots have never been used. 
+    oldest = &glyph_cache[0]; 
+    for (i = 0; i < GLYPH_CACHE_SIZE; i += 1)
+    {
+        glyph = &glyph_cache[i]; 
+        
+        if (glyph->font_data == font_data && glyph->c == c)
+        {
+            glyph->last_use = glyph_cache_tick; 
+            return glyph; 
         }
+        
+        if (glyph->last_use < oldest->last_use)
+            oldest = glyph; 
+    }
     
-    return;
+    // Character not available in this font, nothing to draw. 
+    if ((uint8_t)c < font_data[HEADER_FONT_OFFSET] 
+            || font_data[HEADER_FONT_WIDTH] > GLYPH_MAX_WIDTH 
+            || font_data[HEADER_FONT_HEIGHT] > GLYPH_MAX_HEIGHT)
+        return NULL; 
+    
+    glyph_transpose(oldest, c, font_data); 
+    oldest->last_use = glyph_cache_tick; 
+    return oldest; 
+}
+
+
+static void glyph_transpose(GLYPH_t* glyph, char c, const uint8_t* font_data)
+{
+    const uint8_t*  char_addr; 
+    uint8_t         bytes_per_col; 
+    uint16_t        current_pixel; 
+    uint32_t        i; 
+    uint32_t        j; 
+    
+    glyph->font_data = font_data; 
+    glyph->c         = c; 
+    glyph->width     = font_data[HEADER_FONT_WIDTH]; 
+    glyph->height    = font_data[HEADER_FONT_HEIGHT]; 
+    memset(glyph->mask, 0, sizeof(glyph->mask)); 
+    
+    bytes_per_col = (glyph->height > sizeof(uint8_t) * 8) ? 2 : 1; 
+    
+    // Get the address of the character we want to convert from the font array. 
+    char_addr = font_data + (FONT_HEADER_SIZE + ((uint8_t)c - font_data[HEADER_FONT_OFFSET]) * glyph->width * bytes_per_col); 
+    
+    // Font bitmaps are column-major with the LSB on top, set the matching 
+    // nibble of each row for every high bit. 
+    for (i = 0; i < glyph->width; i += 1)
+    {
+        if (bytes_per_col == 1)
+            current_pixel = *char_addr;
+        else
+            current_pixel = (char_addr[1] << 8) | char_addr[0]; 
+        
+        for (j = 0; j < glyph->height; j += 1)
+        {
+            if (current_pixel & 0x01)
+                glyph->mask[j][i / 2] |= (i % 2) ? 0x0F : 0xF0; 
+            
+            current_pixel = current_pixel >> 1; 
+        }
+        
+        char_addr += bytes_per_col; 
+    }
+    
+    return; 
 }
@@ -7,6 +7,7 @@
 #include "definitions.h"
 
 #include <stdarg.h>
+#include <string.h>
 #include "../ui/fonts.h"
 #include "../cores/systick.h"
 
@@ -21,13 +22,31 @@
 #define DISPLAY_LOGICAL_WIDTH   256 / (8 / BIT_PER_PIXEL)
 #define DISPLAY_LOGICAL_HEIGHT  64
 #define BUFFER_SIZE             DISPLAY_LOGICAL_WIDTH * DISPLAY_LOGICAL_HEIGHT
+#define FRAMEBUFFER_COUNT       2
 #define PRINTF_BUFFER_SIZE      64
 
+#define SSD1362_WINDOW_CMD_SIZE 6
+
+#define GLYPH_CACHE_SIZE        32
+#define GLYPH_MAX_WIDTH         10
+#define GLYPH_MAX_HEIGHT        16
+#define GLYPH_MAX_ROW_BYTES     ((GLYPH_MAX_WIDTH + 1) / 2)
+
+#define IMG_OPAQUE              0xFF
+
+#define RLE_LITERAL_FLAG        0x80
+#define RLE_COUNT_MASK          0x7F
+
 #define MAX_INTENSITY           0x0E
 #define HALF_INTENSITY          MAX_INTENSITY / 2
 #define QUARTER_INTENSITY       MAX_INTENSITY / 4
 #define MIN_INTENSITY           0x00
 
+// Refresh counters: field of SSD1362_STATS_t and key in the telemetry payload. 
+#define SSD1362_STATS_COUNTERS  X(frames_sent,      "disp_sent")    \
+                                X(frames_skipped,   "disp_skipped") \
+                                X(bytes_sent,       "disp_bytes")
+
 
 #define SSD1362_INIT_CONFIG X(0xFD) \
                             X(0x12) \
@@ -108,6 +127,50 @@ typedef union pixel_intensity
 }   PIXEL_INTENSITY_t;
 
 
+/// @struct DIRTY_AREA_t
+/// @brief bounding box of the framebuffer region modified since the last 
+///        transfer. Columns are controller columns (two pixels per column). 
+typedef struct dirty_area
+{
+    bool    is_dirty;   ///< At least one pixel has been modified. 
+    uint8_t col_start;  ///< First modified column. 
+    uint8_t col_end;    ///< Last modified column (inclusive). 
+    uint8_t row_start;  ///< First modified row. 
+    uint8_t row_end;    ///< Last modified row (inclusive). 
+}   DIRTY_AREA_t;
+
+
+/// @struct SSD1362_STATS_t
+/// @brief refresh counters since boot, published with the measurements to 
+///        check the SPI traffic saved in the field. 
+typedef struct ssd1362_stats
+{
+    uint32_t frames_sent;       ///< Refreshes that started a transfer. 
+    uint32_t frames_skipped;    ///< Refreshes skipped because nothing changed on screen. 
+    uint32_t bytes_sent;        ///< Framebuffer bytes sent to the controller. 
+}   SSD1362_STATS_t;
+
+
+/// @struct GLYPH_t
+/// @brief character converted from the column-major font bitmap to row-major 
+///        nibble-packed masks (0xF for each set pixel), ready to be blitted 
+///        into the framebuffer with whole-byte masks. 
+typedef struct glyph
+{
+    const uint8_t*  font_data;  ///< Font of the glyph, NULL if the slot is free. 
+    char            c;          ///< Character of the glyph. 
+    uint8_t         width;      ///< Width of the glyph in pixels. 
+    uint8_t         height;     ///< Height of the glyph in pixels. 
+    uint32_t        last_use;   ///< Cache tick of the last use, used for eviction. 
+    uint8_t         mask[GLYPH_MAX_HEIGHT][GLYPH_MAX_ROW_BYTES]; 
+}   GLYPH_t;
+
+
+//* _ EXTERN VARIABLE DECLARATIONS _____________________________________________
+
+extern SSD1362_STATS_t SSD1362_stats; 
+
+
 //* _ HARDWARE FUNCTION DECLARATIONS ___________________________________________
 
 /// @fn void display_init(); 
@@ -121,7 +184,10 @@ void SSD1362_task(void);
 
 
 /// @fn bool ssd1362_refresh(void);  
-/// @brief send the framebuffer data to the screen. 
+/// @brief swap the back buffer with the front buffer and send the modified 
+///        area to the screen. If a transfer is still running, the swap is 
+///        delayed until it ends. Nothing is sent if the back buffer matches 
+///        the frame already on screen. 
 void SSD1362_refresh(void); 
 
 
@@ -210,7 +276,9 @@ void display_draw_fillrect(uint32_t x, uint32_t y, uint32_t w, uint32_t h, uint8
 
 
 /// @fn display_draw_char(uint32_t x, uint32_t y, char c, uint8_t fg_intensity); 
-/// @brief draws a character contained in the ACSII table. 
+/// @brief draws a character contained in the ACSII table. The character is 
+///        converted to a row-major glyph on first use and kept in a small 
+///        cache, then blitted byte by byte. 
 /// @param x            x coordinate. 
 /// @param y            y coordinate. 
 /// @param c            character to draw. 
@@ -231,7 +299,8 @@ uint32_t display_printf(uint32_t x, uint32_t y, uint8_t fg_intensity, FONTS_t fo
 
 
 /// @fn void display_img(uint32_t x, uint32_t y, uint32_t w, uint32_t h, uint8_t* img);  
-/// @brief displays an image contained in an uint8_t array. 
+/// @brief displays an image contained in an uint8_t array, at any x 
+///        coordinate. Parts of the image outside of the screen are skipped. 
 /// @param x   x coordinate. 
 /// @param y   y coordinate. 
 /// @param w   width of the image. 
@@ -239,4 +308,32 @@ uint32_t display_printf(uint32_t x, uint32_t y, uint8_t fg_intensity, FONTS_t fo
 /// @param img uint8_t array that contains pixel data of the image. 
 void display_img(uint32_t x, uint32_t y, uint32_t w, uint32_t h, const uint8_t* img); 
 
+
+/// @fn void display_img_transparent(uint32_t x, uint32_t y, uint32_t w, uint32_t h, const uint8_t* img, uint8_t key); 
+/// @brief displays an image like display_img, pixels of the key intensity 
+///        are not drawn and let the screen content show through. 
+/// @param x   x coordinate. 
+/// @param y   y coordinate. 
+/// @param w   width of the image. 
+/// @param h   height of the image. 
+/// @param img uint8_t array that contains pixel data of the image. 
+/// @param key transparent intensity. 
+void display_img_transparent(uint32_t x, uint32_t y, uint32_t w, uint32_t h, const uint8_t* img, uint8_t key); 
+
+
+/// @fn void display_img_rle(uint32_t x, uint32_t y, uint32_t w, uint32_t h, const uint8_t* img); 
+/// @brief displays a run-length encoded image, decoded straight into the 
+///        framebuffer. Pixels are encoded row after row, each row padded to an 
+///        even width like raw images, with a sequence of packets : 
+///        - 0b0nnnnnnn, 0x0i    : n + 1 pixels of intensity i. 
+///        - 0b1nnnnnnn, data... : n + 1 pixels packed two per byte, first 
+///                                pixel in the high nibble. 
+///        Runs can cross row boundaries. Use tools/img2rle.py to generate them. 
+/// @param x   x coordinate. 
+/// @param y   y coordinate. 
+/// @param w   width of the image. 
+/// @param h   height of the image. 
+/// @param img uint8_t array that contains the encoded image. 
+void display_img_rle(uint32_t x, uint32_t y, uint32_t w, uint32_t h, const uint8_t* img); 
+
 #endif
\ No newline at end of file
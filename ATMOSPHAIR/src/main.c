@@ -5,6 +5,8 @@
 #include "definitions.h"
 
 #include "cores/systick.h"
+#include "cores/uart.h"
+#include "cores/i2c.h"
 
 #include "drivers/ssd1362.h"
 #include "drivers/sen6x.h"
@@ -20,10 +22,25 @@
 #include "utils/utils.h"
 #include "drivers/led.h"
 #include "processes/alert.h"
+#include "processes/history.h"
+
+//* _ BOOT SEQUENCE ____________________________________________________________
+
+// Steps are driven by the module tasks in the main loop, the UI starts once 
+// the first measurement is received. A step that doesn't complete in time is 
+// skipped, the device keeps working without it. 
+static const BOOT_STEP_t BOOT_STEPS[] = {
+    {.name = "SENSOR DETECTION",    .is_done = SEN6X_is_ready,      .timeout_ms = 3000}, 
+//    {.name = "MODEM SETUP",         .is_done = M95_is_ready,        .timeout_ms = 30000}, 
+    {.name = "FIRST MEASUREMENT",   .is_done = SEN6X_has_sample,    .timeout_ms = 5000}, 
+}; 
+
 
 //* _ ENTRY POINT ______________________________________________________________
 int main(void)
 {
+    uint32_t boot_step           = 0; 
+    uint32_t boot_step_timestamp = 0; 
 
     //* _ MODULE INITIALIZATIONS _______________________________________________
     SYS_Initialize(NULL);
@@ -33,6 +50,7 @@ int main(void)
     SYSTICK_init(); 
     ADC_init(); 
 //    M95_init(); 
+    I2C_init(&I2C_SERCOM1_PLIB); 
     SEN6X_init(); 
     HID_init(); 
     LED_init();
@@ -44,23 +62,57 @@ int main(void)
         // Maintain state machines of all polled MPLAB Harmony modules.
         SYS_Tasks();
         BUZZER_task(); 
+        I2C_task(); 
         SEN6X_task(); 
 //        M95_tasks(); 
         ADC_task(); 
         LED_task(); 
         SSD1362_task(); 
+        HISTORY_task(); 
         
-        
-        O2_sensor_process(); 
+        GAS_sensors_process(); 
         
         check_alert_threshold(); 
         
         
-        display_fill(MIN_INTENSITY); 
-        draw_menu_widget(0, 0, 57); 
+        // Boot progress screen until every boot step completed or timed out, 
+        // the time of each step since power up is logged on the debug UART. 
+        // Measurements, alerts and buttons are handled during the boot. 
+        if (boot_step < ARRAY_SIZE(BOOT_STEPS))
+        {
+            if (BOOT_STEPS[boot_step].is_done())
+            {
+                UART_debug_printf("boot: %s done after %lu ms\r\n", BOOT_STEPS[boot_step].name, (unsigned long)SYSTICK_millis()); 
+                boot_step          += 1; 
+                boot_step_timestamp = SYSTICK_millis(); 
+            }
+            
+            else if (SYSTICK_millis() - boot_step_timestamp > BOOT_STEPS[boot_step].timeout_ms)
+            {
+                UART_debug_printf("boot: %s failed after %lu ms\r\n", BOOT_STEPS[boot_step].name, (unsigned long)SYSTICK_millis()); 
+                boot_step          += 1; 
+                boot_step_timestamp = SYSTICK_millis(); 
+            }
+            
+            if (boot_step < ARRAY_SIZE(BOOT_STEPS))
+                display_boot_page(BOOT_STEPS, ARRAY_SIZE(BOOT_STEPS), boot_step); 
+            
+            // Leave the boot screen, the whole UI is drawn again. 
+            else
+            {
+                display_fill(MIN_INTENSITY); 
+                menu_widget_invalidate(); 
+                page_invalidate(); 
+            }
+        }
         
-
-        display_page(); 
+        // The UI is retained on the framebuffer, only the widgets that changed 
+        // are redrawn. 
+        if (boot_step >= ARRAY_SIZE(BOOT_STEPS))
+        {
+            draw_menu_widget(0, 0, 57); 
+            display_page(); 
+        }
         
         SSD1362_refresh(); 
         
@@ -3,6 +3,9 @@
 
 ALERT_DETECTION_t               alert_detected;
 
+// Sequence number of the last SEN6x sample checked. 
+static uint32_t                 checked_sequence = 0; 
+
 
 static const ALERT_THRESHOLD_t  DATA_THRESHOLD[] = {
     {
@@ -56,14 +59,21 @@ void check_alert_threshold(void)
     uint32_t                 i; 
     const ALERT_THRESHOLD_t* current_data; 
     
+    // Thresholds only need a new check when a new sample arrived. 
+    if (SEN6X_data.sequence == checked_sequence)
+        return; 
+    
+    checked_sequence = SEN6X_data.sequence; 
     
     for (i = 0; i < ARRAY_SIZE(DATA_THRESHOLD); i += 1)
     {
         current_data = &(DATA_THRESHOLD[i]); 
         
-        if (current_data->data)
+        // Thresholds are scaled to the sensor ticks, the comparison stays on 
+        // integers. A field without a valid value keeps its alert state. 
+        if (current_data->data && current_data->data->is_valid)
         {
-            if (*(current_data->data) > current_data->high_threshold)
+            if (current_data->data->raw > current_data->high_threshold * current_data->data->divider)
                 alert_detected.alert |= (1 << i); 
             
             else 
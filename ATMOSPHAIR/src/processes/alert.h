@@ -10,32 +10,32 @@
 #include "../drivers/sen6x.h"
 #include "../utils/utils.h"
 
-#define PM_0_5_ALERT_THRESHOLD          10.0f   // ug/m3
-#define PM_1_0_ALERT_THRESHOLD          10.0f   // ug/m3
-#define PM_2_5_ALERT_THRESHOLD          25.0f   // ug/m3
-#define PM_4_0_ALERT_THRESHOLD          30.0f   // ug/m3
-#define PM_10_0_ALERT_THRESHOLD         50.0f   // ug/m3
+#define PM_0_5_ALERT_THRESHOLD          10      // ug/m3
+#define PM_1_0_ALERT_THRESHOLD          10      // ug/m3
+#define PM_2_5_ALERT_THRESHOLD          25      // ug/m3
+#define PM_4_0_ALERT_THRESHOLD          30      // ug/m3
+#define PM_10_0_ALERT_THRESHOLD         50      // ug/m3
 
-#define RH_ALERT_THRESHOLD              60.0f   // %
-#define TEMP_ALERT_THRESHOLD            45.0f   // °C
+#define RH_ALERT_THRESHOLD              60      // %
+#define TEMP_ALERT_THRESHOLD            45      // °C
 
-#define VOC_ALERT_THRESHOLD             200.0f  // Index
-#define NOX_ALERT_THRESHOLD             200.0f  // Index
-#define CO2_ALERT_THRESHOLD             5000.0f // PPM
-#define HCHO_ALERT_THRESHOLD            100.0f  // PPB
+#define VOC_ALERT_THRESHOLD             200     // Index
+#define NOX_ALERT_THRESHOLD             200     // Index
+#define CO2_ALERT_THRESHOLD             5000    // PPM
+#define HCHO_ALERT_THRESHOLD            100     // PPB
 
-#define CO_ALERT_THRESHOLD              100.0f  // PPM
-#define O2_ALERT_THRESHOLD              100.0f  // PPM
-#define H2S_ALERT_THRESHOLD             100.0f  // PPM
-#define FLAMMABLE_GASES_ALERT_THRESHOLD 100.0f  // PPB
+#define CO_ALERT_THRESHOLD              100     // PPM
+#define O2_ALERT_THRESHOLD              100     // PPM
+#define H2S_ALERT_THRESHOLD             100     // PPM
+#define FLAMMABLE_GASES_ALERT_THRESHOLD 100     // PPB
 
 
 
 typedef struct alert_threshold
 {
-    float*  data; 
-    float   low_threshold; 
-    float   high_threshold; 
+    const MEASUREMENT_t*    data; 
+    int32_t                 low_threshold;  ///< In the measurement unit. 
+    int32_t                 high_threshold; ///< In the measurement unit. 
 }   ALERT_THRESHOLD_t;
 
 
@@ -0,0 +1,355 @@
+#include "history.h"
+
+
+//* _ STATIC VARIABLE DECLARATIONS _____________________________________________
+
+static uint8_t          tier_0_data[HISTORY_METRIC_COUNT][HISTORY_TIER_0_SIZE]; 
+static uint8_t          tier_1_data[HISTORY_METRIC_COUNT][HISTORY_TIER_1_SIZE]; 
+static uint8_t          tier_2_data[HISTORY_METRIC_COUNT][HISTORY_TIER_2_SIZE]; 
+
+static HISTORY_RING_t   rings[HISTORY_METRIC_COUNT][HISTORY_TIER_COUNT]; 
+static HISTORY_ACC_t    accumulators[HISTORY_METRIC_COUNT][HISTORY_TIER_COUNT]; 
+
+static bool             is_init             = false; 
+static uint32_t         bucket_timestamp    = 0; 
+static uint32_t         tier_1_buckets      = 0; 
+static uint32_t         tier_2_buckets      = 0; 
+static uint32_t         fed_sequence        = 0; 
+static uint32_t         tier_sequences[HISTORY_TIER_COUNT] = {0}; 
+
+_Static_assert(sizeof(tier_0_data) + sizeof(tier_1_data) + sizeof(tier_2_data)
+        + sizeof(rings) + sizeof(accumulators) <= HISTORY_RAM_BUDGET,
+        "history doesn't fit in its RAM budget"); 
+
+
+//* _ STATIC FUNCTION DECLARATIONS _____________________________________________
+
+static void     HISTORY_init(void); 
+static void     HISTORY_feed(void); 
+
+/// @fn static void acc_add(HISTORY_ACC_t* acc, int32_t value, uint32_t weight); 
+/// @brief adds value weight times to a bucket being aggregated. 
+static void     acc_add(HISTORY_ACC_t* acc, int32_t value, uint32_t weight); 
+
+/// @fn static void acc_merge(HISTORY_ACC_t* acc, const HISTORY_ACC_t* from); 
+/// @brief adds the samples of a closed bucket to the next tier bucket. 
+static void     acc_merge(HISTORY_ACC_t* acc, const HISTORY_ACC_t* from); 
+
+/// @fn static void close_tier(HISTORY_TIER_t tier); 
+/// @brief appends the current bucket of every metric to the tier ring, then 
+///        merges it in the next tier and restarts it. 
+static void     close_tier(HISTORY_TIER_t tier); 
+
+static void     ring_append(HISTORY_RING_t* ring, const HISTORY_ACC_t* acc); 
+static void     ring_evict(HISTORY_RING_t* ring); 
+
+/// @fn static uint16_t ring_decode(const HISTORY_RING_t* ring, uint16_t pos, int32_t prev_mean, HISTORY_BUCKET_t* bucket); 
+/// @brief decodes the bucket starting at pos. 
+/// @param prev_mean mean of the previous bucket, reference of the delta. 
+/// @return the position of the next bucket. 
+static uint16_t ring_decode(const HISTORY_RING_t* ring, uint16_t pos, int32_t prev_mean, HISTORY_BUCKET_t* bucket); 
+
+static uint32_t varint_write(uint8_t* buffer, uint64_t value); 
+static uint64_t varint_read(const HISTORY_RING_t* ring, uint16_t* pos); 
+
+
+//* _ FUNCTION IMPLEMENTATION __________________________________________________
+
+void HISTORY_task(void)
+{
+    if (!is_init)
+        HISTORY_init(); 
+    
+    HISTORY_feed(); 
+    
+    // Buckets missed while the main loop was busy are closed empty. 
+    while (SYSTICK_millis() - bucket_timestamp >= HISTORY_BASE_PERIOD_MS)
+    {
+        bucket_timestamp += HISTORY_BASE_PERIOD_MS; 
+        close_tier(HISTORY_TIER_1S); 
+    
+        tier_1_buckets += 1; 
+        if (tier_1_buckets < HISTORY_TIER_1_RATIO)
+            continue; 
+    
+        tier_1_buckets = 0; 
+        close_tier(HISTORY_TIER_5MIN); 
+    
+        tier_2_buckets += 1; 
+        if (tier_2_buckets < HISTORY_TIER_2_RATIO)
+            continue; 
+    
+        tier_2_buckets = 0; 
+        close_tier(HISTORY_TIER_1H); 
+    }
+    
+    return; 
+}
+
+
+uint32_t HISTORY_read(HISTORY_METRIC_t metric, HISTORY_TIER_t tier, HISTORY_BUCKET_t* buckets, uint32_t max_count)
+{
+    const HISTORY_RING_t*   ring; 
+    HISTORY_BUCKET_t        bucket; 
+    uint32_t                skipped; 
+    uint32_t                written; 
+    uint32_t                i; 
+    uint16_t                pos; 
+    int32_t                 mean; 
+    
+    if (metric >= HISTORY_METRIC_COUNT || tier >= HISTORY_TIER_COUNT || !is_init)
+        return 0; 
+    
+    ring    = &rings[metric][tier]; 
+    skipped = (ring->count > max_count) ? ring->count - max_count : 0; 
+    written = 0; 
+    pos     = ring->tail; 
+    mean    = ring->tail_mean; 
+    
+    // Every delta depends on the previous bucket, the ring is decoded from 
+    // its oldest bucket. 
+    for (i = 0; i < ring->count; i += 1)
+    {
+        pos  = ring_decode(ring, pos, mean, &bucket); 
+        mean = bucket.mean; 
+    
+        if (i >= skipped)
+            buckets[written++] = bucket; 
+    }
+    
+    return written; 
+}
+
+
+uint32_t HISTORY_sequence(HISTORY_TIER_t tier)
+{
+    if (tier >= HISTORY_TIER_COUNT)
+        return 0; 
+    
+    return tier_sequences[tier]; 
+}
+
+
+//* _ STATIC FUNCTION IMPLEMENTATION ___________________________________________
+
+static void HISTORY_init(void)
+{
+    uint32_t i; 
+    
+    for (i = 0; i < HISTORY_METRIC_COUNT; i += 1)
+    {
+        rings[i][HISTORY_TIER_1S]   = (HISTORY_RING_t){.data = tier_0_data[i], .size = HISTORY_TIER_0_SIZE}; 
+        rings[i][HISTORY_TIER_5MIN] = (HISTORY_RING_t){.data = tier_1_data[i], .size = HISTORY_TIER_1_SIZE}; 
+        rings[i][HISTORY_TIER_1H]   = (HISTORY_RING_t){.data = tier_2_data[i], .size = HISTORY_TIER_2_SIZE}; 
+    }
+    
+    bucket_timestamp = SYSTICK_millis(); 
+    is_init          = true; 
+    return; 
+}
+
+
+static void HISTORY_feed(void)
+{
+    // A SEN6x sample is only added once, fields missing from it are skipped. 
+    if (SEN6X_data.sequence != fed_sequence)
+    {
+        fed_sequence = SEN6X_data.sequence; 
+    
+        #define X(id, source)   if (SEN6X_data.source.is_valid)                                 \
+                                    acc_add(&accumulators[id][HISTORY_TIER_1S], SEN6X_data.source.raw, 1); 
+    
+            HISTORY_SEN6X_METRICS
+        #undef X
+    }
+    
+    #define X(id, source)   if (ADC_data[source].data_is_new)                                       \
+                            {                                                                       \
+                                ADC_data[source].data_is_new = false;                               \
+                                acc_add(&accumulators[id][HISTORY_TIER_1S], ADC_data[source].ema_filtered_data, 1); \
+                            }
+    
+        HISTORY_ADC_METRICS
+    #undef X
+    
+    return; 
+}
+
+
+static void acc_add(HISTORY_ACC_t* acc, int32_t value, uint32_t weight)
+{
+    if (acc->count == 0 || value < acc->min)
+        acc->min = value; 
+    
+    if (acc->count == 0 || value > acc->max)
+        acc->max = value; 
+    
+    acc->sum   += (int64_t)value * weight; 
+    acc->count += weight; 
+    return; 
+}
+
+
+static void acc_merge(HISTORY_ACC_t* acc, const HISTORY_ACC_t* from)
+{
+    if (from->count == 0)
+        return; 
+    
+    if (acc->count == 0 || from->min < acc->min)
+        acc->min = from->min; 
+    
+    if (acc->count == 0 || from->max > acc->max)
+        acc->max = from->max; 
+    
+    acc->sum   += from->sum; 
+    acc->count += from->count; 
+    return; 
+}
+
+
+static void close_tier(HISTORY_TIER_t tier)
+{
+    uint32_t i; 
+    
+    for (i = 0; i < HISTORY_METRIC_COUNT; i += 1)
+    {
+        ring_append(&rings[i][tier], &accumulators[i][tier]); 
+    
+        // The next tier mean is weighted by the samples, not by the buckets. 
+        if (tier + 1 < HISTORY_TIER_COUNT)
+            acc_merge(&accumulators[i][tier + 1], &accumulators[i][tier]); 
+    
+        accumulators[i][tier] = (HISTORY_ACC_t){0}; 
+    }
+    
+    tier_sequences[tier] += 1; 
+    return; 
+}
+
+
+static void ring_append(HISTORY_RING_t* ring, const HISTORY_ACC_t* acc)
+{
+    uint8_t     encoded[HISTORY_BUCKET_MAX_SIZE]; 
+    uint32_t    length; 
+    uint32_t    i; 
+    int32_t     mean; 
+    int32_t     delta; 
+    
+    if (acc->count == 0)
+    {
+        mean   = ring->head_mean; 
+        length = varint_write(encoded, HISTORY_FLAG_EMPTY); 
+    }
+    
+    else
+    {
+        // Mean rounded to the nearest tick. 
+        if (acc->sum >= 0)
+            mean = (acc->sum + acc->count / 2) / acc->count; 
+    
+        else
+            mean = (acc->sum - (int64_t)(acc->count / 2)) / acc->count; 
+    
+        delta  = mean - ring->head_mean; 
+        length = varint_write(encoded,
+            ((uint64_t)ZIGZAG_ENCODE(delta) << HISTORY_FLAG_BITS)
+            | ((acc->min == acc->max) ? HISTORY_FLAG_FLAT : HISTORY_FLAG_SPREAD)); 
+    
+        if (acc->min != acc->max)
+        {
+            length += varint_write(&encoded[length], (uint32_t)(mean - acc->min)); 
+            length += varint_write(&encoded[length], (uint32_t)(acc->max - mean)); 
+        }
+    }
+    
+    // Make room by dropping the oldest buckets. 
+    while ((uint32_t)(ring->size - ring->used) < length)
+        ring_evict(ring); 
+    
+    for (i = 0; i < length; i += 1)
+    {
+        ring->data[ring->head] = encoded[i]; 
+        ring->head = (ring->head + 1) % ring->size; 
+    }
+    
+    ring->used     += length; 
+    ring->count    += 1; 
+    ring->head_mean = mean; 
+    return; 
+}
+
+
+static void ring_evict(HISTORY_RING_t* ring)
+{
+    HISTORY_BUCKET_t    bucket; 
+    uint16_t            next; 
+    
+    next = ring_decode(ring, ring->tail, ring->tail_mean, &bucket); 
+    
+    ring->used     -= (next - ring->tail + ring->size) % ring->size; 
+    ring->tail      = next; 
+    ring->tail_mean = bucket.mean; 
+    ring->count    -= 1; 
+    return; 
+}
+
+
+static uint16_t ring_decode(const HISTORY_RING_t* ring, uint16_t pos, int32_t prev_mean, HISTORY_BUCKET_t* bucket)
+{
+    uint64_t    header; 
+    uint32_t    flag; 
+    
+    header = varint_read(ring, &pos); 
+    flag   = header & HISTORY_FLAG_MASK; 
+    
+    bucket->is_empty = flag == HISTORY_FLAG_EMPTY; 
+    bucket->mean     = prev_mean + ZIGZAG_DECODE((uint32_t)(header >> HISTORY_FLAG_BITS)); 
+    bucket->min      = bucket->mean; 
+    bucket->max      = bucket->mean; 
+    
+    if (flag == HISTORY_FLAG_SPREAD)
+    {
+        bucket->min = bucket->mean - (int32_t)varint_read(ring, &pos); 
+        bucket->max = bucket->mean + (int32_t)varint_read(ring, &pos); 
+    }
+    
+    return pos; 
+}
+
+
+static uint32_t varint_write(uint8_t* buffer, uint64_t value)
+{
+    uint32_t length; 
+    
+    // 7 bits per byte, least significant first, the last byte has its 
+    // continue flag cleared. 
+    length = 0; 
+    while (value >= VARINT_CONTINUE_FLAG)
+    {
+        buffer[length++] = (uint8_t)(value | VARINT_CONTINUE_FLAG); 
+        value >>= VARINT_PAYLOAD_BITS; 
+    }
+    
+    buffer[length++] = (uint8_t)value; 
+    return length; 
+}
+
+
+static uint64_t varint_read(const HISTORY_RING_t* ring, uint16_t* pos)
+{
+    uint64_t    value; 
+    uint32_t    shift; 
+    uint8_t     byte; 
+    
+    value = 0; 
+    shift = 0; 
+    do
+    {
+        byte   = ring->data[*pos]; 
+        *pos   = (*pos + 1) % ring->size; 
+        value |= (uint64_t)(byte & ~VARINT_CONTINUE_FLAG) << shift; 
+        shift += VARINT_PAYLOAD_BITS; 
+    }   while (byte & VARINT_CONTINUE_FLAG); 
+    
+    return value; 
+}
@@ -0,0 +1,136 @@
+#ifndef _HISTORY_H_
+#define _HISTORY_H_
+
+//* _ INCLUDES _________________________________________________________________
+#include <stdlib.h>
+#include "definitions.h"
+
+#include "../cores/systick.h"
+#include "../cores/adc.h"
+#include "../drivers/sen6x.h"
+#include "../utils/utils.h"
+
+
+//* _ DEFINITIONS ______________________________________________________________
+
+// Tracked metrics, SEN6x measurements are stored in sensor ticks and ADC 
+// channels in filtered conversion counts. 
+#define HISTORY_SEN6X_METRICS       X(HISTORY_PM_2_5,   PM_2_5)     \
+                                    X(HISTORY_TEMP,     temp)       \
+                                    X(HISTORY_RH,       humidity)   \
+                                    X(HISTORY_VOC,      VOC)        \
+                                    X(HISTORY_NOX,      NOx)        \
+                                    X(HISTORY_CO2,      CO2)
+
+#define HISTORY_ADC_METRICS         X(HISTORY_H2S,      ADC_H2S)    \
+                                    X(HISTORY_O2,       ADC_O2)     \
+                                    X(HISTORY_CO,       ADC_CO)     \
+                                    X(HISTORY_FLAMMABLE_GASES, ADC_FLAMMABLE_GASES)
+
+// Tiers, each bucket of a tier aggregates RATIO buckets of the previous one. 
+#define HISTORY_BASE_PERIOD_MS      1000
+#define HISTORY_TIER_1_RATIO        300         // 5 min buckets.
+#define HISTORY_TIER_2_RATIO        12          // 1 h buckets.
+
+// Ring sizes in bytes per metric. A steady 1 s bucket takes 1 byte, a 5 min 
+// bucket about 3 bytes and a 1 h bucket about 4 bytes: 10 min, 24 h and 
+// 7 days. When the signal is noisier the oldest buckets are dropped earlier. 
+#define HISTORY_TIER_0_SIZE         600
+#define HISTORY_TIER_1_SIZE         896
+#define HISTORY_TIER_2_SIZE         704
+#define HISTORY_RAM_BUDGET          (24 * 1024)
+
+// Bucket encoding, first varint: zigzag(mean delta) << 2 | flag. A spread 
+// bucket is followed by the varints (mean - min) and (max - mean). 
+#define HISTORY_FLAG_BITS           2
+#define HISTORY_FLAG_MASK           0x03
+#define HISTORY_FLAG_FLAT           0x00        ///< min = max = mean. 
+#define HISTORY_FLAG_SPREAD         0x01
+#define HISTORY_FLAG_EMPTY          0x02        ///< No sample during the bucket. 
+#define HISTORY_BUCKET_MAX_SIZE     15
+#define VARINT_PAYLOAD_BITS         7
+#define VARINT_CONTINUE_FLAG        0x80
+
+
+//* _ ENUMERATIONS _____________________________________________________________
+
+typedef enum history_metric
+{
+    #define X(id, source)   id,
+        HISTORY_SEN6X_METRICS
+        HISTORY_ADC_METRICS
+    #undef X
+    HISTORY_METRIC_COUNT,
+}   HISTORY_METRIC_t; 
+
+
+typedef enum history_tier
+{
+    HISTORY_TIER_1S,
+    HISTORY_TIER_5MIN,
+    HISTORY_TIER_1H,
+    HISTORY_TIER_COUNT,
+}   HISTORY_TIER_t; 
+
+
+//* _ STRUCTURE DEFINITIONS ____________________________________________________
+
+/// @struct HISTORY_BUCKET_t 
+/// @brief decoded bucket, values in the unit of the metric source. 
+typedef struct history_bucket
+{
+    int32_t min; 
+    int32_t max; 
+    int32_t mean; 
+    bool    is_empty;   ///< No sample during the bucket, values are meaningless. 
+}   HISTORY_BUCKET_t; 
+
+
+/// @struct HISTORY_ACC_t 
+/// @brief bucket being aggregated. 
+typedef struct history_acc
+{
+    int64_t     sum; 
+    int32_t     min; 
+    int32_t     max; 
+    uint32_t    count;  ///< Number of samples, the mean is weighted by it. 
+}   HISTORY_ACC_t; 
+
+
+/// @struct HISTORY_RING_t 
+/// @brief delta encoded buckets, the oldest ones are dropped to make room. 
+typedef struct history_ring
+{
+    uint8_t*    data; 
+    uint16_t    size; 
+    uint16_t    head;       ///< Next byte written. 
+    uint16_t    tail;       ///< First byte of the oldest bucket. 
+    uint16_t    used; 
+    uint16_t    count;      ///< Number of buckets. 
+    int32_t     tail_mean;  ///< Reference mean of the oldest bucket delta. 
+    int32_t     head_mean;  ///< Mean of the newest bucket. 
+}   HISTORY_RING_t; 
+
+
+//* _ FUNCTION DECLARATIONS ____________________________________________________
+
+/// @fn void HISTORY_task(void); 
+/// @brief feeds the new SEN6x samples and ADC conversions to the history 
+///        and closes the buckets of each tier when their period elapsed. 
+void HISTORY_task(void); 
+
+
+/// @fn uint32_t HISTORY_read(HISTORY_METRIC_t metric, HISTORY_TIER_t tier, HISTORY_BUCKET_t* buckets, uint32_t max_count); 
+/// @brief decodes the newest buckets of a tier. 
+/// @param buckets filled oldest first. 
+/// @param max_count capacity of buckets. 
+/// @return the number of buckets written. 
+uint32_t HISTORY_read(HISTORY_METRIC_t metric, HISTORY_TIER_t tier, HISTORY_BUCKET_t* buckets, uint32_t max_count); 
+
+
+/// @fn uint32_t HISTORY_sequence(HISTORY_TIER_t tier); 
+/// @brief number of buckets closed in a tier since boot, the newest bucket 
+///        returned by HISTORY_read is the number (sequence - 1). 
+uint32_t HISTORY_sequence(HISTORY_TIER_t tier); 
+
+#endif
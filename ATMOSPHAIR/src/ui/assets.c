@@ -2,140 +2,57 @@
 
 //* _ UI ELEMENTS ______________________________________________________________
 
+// Menu images are run-length encoded, see display_img_rle().
+
 const uint8_t MENU_LEFT_ASSET[] = {
-    0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 
-    0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 
-    0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0x00, 0xEE, 0xEE, 
-    0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 
-    0xEE, 0x00, 0x00, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 
-    0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xE0, 0x00, 0x00, 0xEE, 0xEE, 0xEE, 0xEE, 
-    0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xE0, 0x00, 
-    0x00, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 
-    0xEE, 0xEE, 0xEE, 0x00, 0x00, 0x00, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 
-    0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0x00, 0x00, 0x00, 0xEE, 
-    0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 
-    0xE0, 0x00, 0x00, 0x00, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 
-    0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xE0, 0x00, 0x00, 0x00, 0xEE, 0xEE, 0xEE, 
-    0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xE0, 0x00, 
-    0x00, 0x00, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 
-    0xEE, 0xEE, 0xEE, 0xE0, 0x00, 0x00, 0x00, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 
-    0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xE0, 0x00, 0x00, 0x00, 
-    0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 
-    0xEE, 0xE0, 0x00, 0x00, 0x00, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 
-    0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xE0, 0x00, 0x00, 0x00, 0xEE, 0xEE, 
-    0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xE0, 
-    0x00, 0x00, 0x00, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 
-    0xEE, 0xEE, 0xEE, 0xEE, 0xE0, 0x00, 0x00, 0x00, 0xEE, 0xEE, 0xEE, 0xEE, 
-    0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xE0, 0x00, 0x00, 
-    0x00, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 
-    0xEE, 0xEE, 0xE0, 0x00, 0x00, 0x00, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 
-    0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xE0, 0x00, 0x00, 0x00, 0xEE, 
-    0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 
-    0xE0, 0x00, 0x00, 0x00, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 
-    0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xE0, 0x00, 0x00, 0x00, 0xEE, 0xEE, 0xEE, 
-    0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xE0, 0x00, 
-    0x00, 0x00, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 
-    0xEE, 0xEE, 0xEE, 0xE0, 0x00, 0x00, 0x00, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 
-    0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xE0, 0x00, 0x00, 0x00, 
-    0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 
-    0xEE, 0xE0, 0x00, 0x00, 0x00, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 
-    0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xE0, 0x00, 0x00, 0x00, 0xEE, 0xEE, 
-    0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xE0, 
-    0x00, 0x00, 0x00, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 
-    0xEE, 0xEE, 0xEE, 0xEE, 0xE0, 0x00, 0x00, 0x00, 0xEE, 0xEE, 0xEE, 0xEE, 
-    0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xE0, 0x00, 0x00, 
-    0x00, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 
-    0xEE, 0xEE, 0xE0, 0x00, 0x00, 0x00, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 
-    0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xE0, 0x00, 0x00, 0x00, 0xEE, 
-    0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 
-    0xE0, 0x00, 0x00, 0x00, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 
-    0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xE0, 0x00, 0x00, 0x00, 0xEE, 0xEE, 0xEE, 
-    0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xE0, 0x00, 
-    0x00, 0x00, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 
-    0xEE, 0xEE, 0xEE, 0xE0, 0x00, 0x00, 0x00, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 
-    0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xE0, 0x00, 0x00, 0x00, 
-    0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 
-    0xEE, 0xE0, 0x00, 0x00, 0x00, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 
-    0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xE0, 0x00, 0x00, 0x00, 0xEE, 0xEE, 
-    0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xE0, 
-    0x00, 0x00, 0x00, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 
-    0xEE, 0xEE, 0xEE, 0xEE, 0xE0, 0x00, 0x00, 0x00, 0xEE, 0xEE, 0xEE, 0xEE, 
-    0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xE0, 0x00, 0x00, 
-    0x00, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 
-    0xEE, 0xEE, 0xE0, 0x00, 0x00, 0x00, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 
-    0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xE0, 0x00, 0x00, 0x00, 0xEE, 
-    0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 
-    0xE0, 0x00, 0x00, 0x00, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 
-    0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xE0, 0x00, 0x00, 0x00, 0xEE, 0xEE, 0xEE, 
-    0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xE0, 0x00, 
-    0x00, 0x00, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 
-    0xEE, 0xEE, 0xEE, 0xE0, 0x00, 0x00, 0x00, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 
-    0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xE0, 0x00, 0x00, 0x00, 
-    0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 
-    0xEE, 0xE0, 0x00, 0x00, 0x00, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 
-    0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xE0, 0x00, 0x00, 0x00, 0xEE, 0xEE, 
-    0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xE0, 
-    0x00, 0x00, 0x00, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 
-    0xEE, 0xEE, 0xEE, 0xEE, 0xE0, 0x00, 0x00, 0x00, 0xEE, 0xEE, 0xEE, 0xEE, 
-    0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xE0, 0x00, 0x00, 
-    0x00, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 
-    0xEE, 0xEE, 0xE0, 0x00, 0x00, 0x00, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 
-    0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xE0, 0x00, 0x00, 0x00, 0xEE, 
-    0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 
-    0xE0, 0x00, 0x00, 0x00, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 
-    0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xE0, 0x00, 0x00, 0x00, 0xEE, 0xEE, 0xEE, 
-    0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0x00, 
-    0x00, 0x00, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 
-    0xEE, 0xEE, 0xEE, 0xEE, 0x00, 0x00, 0x00, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 
-    0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xE0, 0x00, 0x00, 
-    0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 
-    0xEE, 0xEE, 0xE0, 0x00, 0x00, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 
-    0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0x00, 0x00, 0xEE, 0xEE, 
-    0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 
-    0xEE, 0xEE, 0x00, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 
-    0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 
+    0x41, 0x0E, 0x81, 0x00, 0x1D, 0x0E, 0x03, 0x00, 0x1C, 0x0E, 0x04, 0x00, 
+    0x1C, 0x0E, 0x04, 0x00, 0x1B, 0x0E, 0x05, 0x00, 0x1B, 0x0E, 0x05, 0x00, 
+    0x1A, 0x0E, 0x06, 0x00, 0x1A, 0x0E, 0x06, 0x00, 0x1A, 0x0E, 0x06, 0x00, 
+    0x1A, 0x0E, 0x06, 0x00, 0x1A, 0x0E, 0x06, 0x00, 0x1A, 0x0E, 0x06, 0x00, 
+    0x1A, 0x0E, 0x06, 0x00, 0x1A, 0x0E, 0x06, 0x00, 0x1A, 0x0E, 0x06, 0x00, 
+    0x1A, 0x0E, 0x06, 0x00, 0x1A, 0x0E, 0x06, 0x00, 0x1A, 0x0E, 0x06, 0x00, 
+    0x1A, 0x0E, 0x06, 0x00, 0x1A, 0x0E, 0x06, 0x00, 0x1A, 0x0E, 0x06, 0x00, 
+    0x1A, 0x0E, 0x06, 0x00, 0x1A, 0x0E, 0x06, 0x00, 0x1A, 0x0E, 0x06, 0x00, 
+    0x1A, 0x0E, 0x06, 0x00, 0x1A, 0x0E, 0x06, 0x00, 0x1A, 0x0E, 0x06, 0x00, 
+    0x1A, 0x0E, 0x06, 0x00, 0x1A, 0x0E, 0x06, 0x00, 0x1A, 0x0E, 0x06, 0x00, 
+    0x1A, 0x0E, 0x06, 0x00, 0x1A, 0x0E, 0x06, 0x00, 0x1A, 0x0E, 0x06, 0x00, 
+    0x1A, 0x0E, 0x06, 0x00, 0x1A, 0x0E, 0x06, 0x00, 0x1A, 0x0E, 0x06, 0x00, 
+    0x1A, 0x0E, 0x06, 0x00, 0x1A, 0x0E, 0x06, 0x00, 0x1A, 0x0E, 0x06, 0x00, 
+    0x1A, 0x0E, 0x06, 0x00, 0x1A, 0x0E, 0x06, 0x00, 0x1A, 0x0E, 0x06, 0x00, 
+    0x1A, 0x0E, 0x06, 0x00, 0x1A, 0x0E, 0x06, 0x00, 0x1A, 0x0E, 0x06, 0x00, 
+    0x1A, 0x0E, 0x06, 0x00, 0x1A, 0x0E, 0x06, 0x00, 0x1A, 0x0E, 0x06, 0x00, 
+    0x1A, 0x0E, 0x06, 0x00, 0x1A, 0x0E, 0x06, 0x00, 0x1A, 0x0E, 0x06, 0x00, 
+    0x1A, 0x0E, 0x06, 0x00, 0x1A, 0x0E, 0x06, 0x00, 0x1A, 0x0E, 0x06, 0x00, 
+    0x1A, 0x0E, 0x06, 0x00, 0x1A, 0x0E, 0x06, 0x00, 0x1B, 0x0E, 0x05, 0x00, 
+    0x1B, 0x0E, 0x05, 0x00, 0x1C, 0x0E, 0x04, 0x00, 0x1C, 0x0E, 0x04, 0x00, 
+    0x1D, 0x0E, 0x03, 0x00, 0x1F, 0x0E, 0x81, 0x00, 0x21, 0x0E, 
 };
 
 
 const uint8_t MENU_RIGHT_ASSET[] = {
-    0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0x00, 0xEE, 0xEE, 0xEE, 0xEE, 
-    0xEE, 0xEE, 0x00, 0x00, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0x00, 0x00, 0x0E, 
-    0xEE, 0xEE, 0xEE, 0xEE, 0x00, 0x00, 0x0E, 0xEE, 0xEE, 0xEE, 0xEE, 0x00, 
-    0x00, 0x00, 0xEE, 0xEE, 0xEE, 0xEE, 0x00, 0x00, 0x00, 0xEE, 0xEE, 0xEE, 
-    0xEE, 0x00, 0x00, 0x00, 0x0E, 0xEE, 0xEE, 0xEE, 0x00, 0x00, 0x00, 0x0E, 
-    0xEE, 0xEE, 0xEE, 0x00, 0x00, 0x00, 0x0E, 0xEE, 0xEE, 0xEE, 0x00, 0x00, 
-    0x00, 0x0E, 0xEE, 0xEE, 0xEE, 0x00, 0x00, 0x00, 0x0E, 0xEE, 0xEE, 0xEE, 
-    0x00, 0x00, 0x00, 0x0E, 0xEE, 0xEE, 0xEE, 0x00, 0x00, 0x00, 0x0E, 0xEE, 
-    0xEE, 0xEE, 0x00, 0x00, 0x00, 0x0E, 0xEE, 0xEE, 0xEE, 0x00, 0x00, 0x00, 
-    0x0E, 0xEE, 0xEE, 0xEE, 0x00, 0x00, 0x00, 0x0E, 0xEE, 0xEE, 0xEE, 0x00, 
-    0x00, 0x00, 0x0E, 0xEE, 0xEE, 0xEE, 0x00, 0x00, 0x00, 0x0E, 0xEE, 0xEE, 
-    0xEE, 0x00, 0x00, 0x00, 0x0E, 0xEE, 0xEE, 0xEE, 0x00, 0x00, 0x00, 0x0E, 
-    0xEE, 0xEE, 0xEE, 0x00, 0x00, 0x00, 0x0E, 0xEE, 0xEE, 0xEE, 0x00, 0x00, 
-    0x00, 0x0E, 0xEE, 0xEE, 0xEE, 0x00, 0x00, 0x00, 0x0E, 0xEE, 0xEE, 0xEE, 
-    0x00, 0x00, 0x00, 0x0E, 0xEE, 0xEE, 0xEE, 0x00, 0x00, 0x00, 0x0E, 0xEE, 
-    0xEE, 0xEE, 0x00, 0x00, 0x00, 0x0E, 0xEE, 0xEE, 0xEE, 0x00, 0x00, 0x00, 
-    0x0E, 0xEE, 0xEE, 0xEE, 0x00, 0x00, 0x00, 0x0E, 0xEE, 0xEE, 0xEE, 0x00, 
-    0x00, 0x00, 0x0E, 0xE0, 0xEE, 0xEE, 0x00, 0x00, 0x00, 0x0E, 0xE0, 0x0E, 
-    0xEE, 0x00, 0x00, 0x00, 0x0E, 0xE0, 0x00, 0xEE, 0x00, 0x00, 0x00, 0x0E, 
-    0xE0, 0x00, 0xEE, 0x00, 0x00, 0x00, 0x0E, 0xE0, 0x0E, 0xEE, 0x00, 0x00, 
-    0x00, 0x0E, 0xE0, 0xEE, 0xEE, 0x00, 0x00, 0x00, 0x0E, 0xEE, 0xEE, 0xEE, 
-    0x00, 0x00, 0x00, 0x0E, 0xEE, 0xEE, 0xEE, 0x00, 0x00, 0x00, 0x0E, 0xEE, 
-    0xEE, 0xEE, 0x00, 0x00, 0x00, 0x0E, 0xEE, 0xEE, 0xEE, 0x00, 0x00, 0x00, 
-    0x0E, 0xEE, 0xEE, 0xEE, 0x00, 0x00, 0x00, 0x0E, 0xEE, 0xEE, 0xEE, 0x00, 
-    0x00, 0x00, 0x0E, 0xEE, 0xEE, 0xEE, 0x00, 0x00, 0x00, 0x0E, 0xEE, 0xEE, 
-    0xEE, 0x00, 0x00, 0x00, 0x0E, 0xEE, 0xEE, 0xEE, 0x00, 0x00, 0x00, 0x0E, 
-    0xEE, 0xEE, 0xEE, 0x00, 0x00, 0x00, 0x0E, 0xEE, 0xEE, 0xEE, 0x00, 0x00, 
-    0x00, 0x0E, 0xEE, 0xEE, 0xEE, 0x00, 0x00, 0x00, 0x0E, 0xEE, 0xEE, 0xEE, 
-    0x00, 0x00, 0x00, 0x0E, 0xEE, 0xEE, 0xEE, 0x00, 0x00, 0x00, 0x0E, 0xEE, 
-    0xEE, 0xEE, 0x00, 0x00, 0x00, 0x0E, 0xEE, 0xEE, 0xEE, 0x00, 0x00, 0x00, 
-    0x0E, 0xEE, 0xEE, 0xEE, 0x00, 0x00, 0x00, 0x0E, 0xEE, 0xEE, 0xEE, 0x00, 
-    0x00, 0x00, 0x0E, 0xEE, 0xEE, 0xEE, 0x00, 0x00, 0x00, 0x0E, 0xEE, 0xEE, 
-    0xEE, 0x00, 0x00, 0x00, 0x0E, 0xEE, 0xEE, 0xEE, 0x00, 0x00, 0x00, 0x0E, 
-    0xEE, 0xEE, 0xEE, 0x00, 0x00, 0x00, 0xEE, 0xEE, 0xEE, 0xEE, 0x00, 0x00, 
-    0x00, 0xEE, 0xEE, 0xEE, 0xEE, 0x00, 0x00, 0x0E, 0xEE, 0xEE, 0xEE, 0xEE, 
-    0x00, 0x00, 0x0E, 0xEE, 0xEE, 0xEE, 0xEE, 0x00, 0x00, 0xEE, 0xEE, 0xEE, 
-    0xEE, 0xEE, 0x00, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 
-    0xEE, 0xEE, 0xEE, 0xEE,  
+    0x0D, 0x0E, 0x81, 0x00, 0x0B, 0x0E, 0x03, 0x00, 0x09, 0x0E, 0x04, 0x00, 
+    0x08, 0x0E, 0x04, 0x00, 0x08, 0x0E, 0x05, 0x00, 0x07, 0x0E, 0x05, 0x00, 
+    0x07, 0x0E, 0x06, 0x00, 0x06, 0x0E, 0x06, 0x00, 0x06, 0x0E, 0x06, 0x00, 
+    0x06, 0x0E, 0x06, 0x00, 0x06, 0x0E, 0x06, 0x00, 0x06, 0x0E, 0x06, 0x00, 
+    0x06, 0x0E, 0x06, 0x00, 0x06, 0x0E, 0x06, 0x00, 0x06, 0x0E, 0x06, 0x00, 
+    0x06, 0x0E, 0x06, 0x00, 0x06, 0x0E, 0x06, 0x00, 0x06, 0x0E, 0x06, 0x00, 
+    0x06, 0x0E, 0x06, 0x00, 0x06, 0x0E, 0x06, 0x00, 0x06, 0x0E, 0x06, 0x00, 
+    0x06, 0x0E, 0x06, 0x00, 0x06, 0x0E, 0x06, 0x00, 0x06, 0x0E, 0x06, 0x00, 
+    0x06, 0x0E, 0x06, 0x00, 0x06, 0x0E, 0x06, 0x00, 0x06, 0x0E, 0x06, 0x00, 
+    0x06, 0x0E, 0x06, 0x00, 0x06, 0x0E, 0x06, 0x00, 0x82, 0xEE, 0x00, 0x03, 
+    0x0E, 0x06, 0x00, 0x83, 0xEE, 0x00, 0x02, 0x0E, 0x06, 0x00, 0x81, 0xEE, 
+    0x02, 0x00, 0x81, 0xEE, 0x06, 0x00, 0x81, 0xEE, 0x02, 0x00, 0x81, 0xEE, 
+    0x06, 0x00, 0x83, 0xEE, 0x00, 0x02, 0x0E, 0x06, 0x00, 0x82, 0xEE, 0x00, 
+    0x03, 0x0E, 0x06, 0x00, 0x06, 0x0E, 0x06, 0x00, 0x06, 0x0E, 0x06, 0x00, 
+    0x06, 0x0E, 0x06, 0x00, 0x06, 0x0E, 0x06, 0x00, 0x06, 0x0E, 0x06, 0x00, 
+    0x06, 0x0E, 0x06, 0x00, 0x06, 0x0E, 0x06, 0x00, 0x06, 0x0E, 0x06, 0x00, 
+    0x06, 0x0E, 0x06, 0x00, 0x06, 0x0E, 0x06, 0x00, 0x06, 0x0E, 0x06, 0x00, 
+    0x06, 0x0E, 0x06, 0x00, 0x06, 0x0E, 0x06, 0x00, 0x06, 0x0E, 0x06, 0x00, 
+    0x06, 0x0E, 0x06, 0x00, 0x06, 0x0E, 0x06, 0x00, 0x06, 0x0E, 0x06, 0x00, 
+    0x06, 0x0E, 0x06, 0x00, 0x06, 0x0E, 0x06, 0x00, 0x06, 0x0E, 0x06, 0x00, 
+    0x06, 0x0E, 0x06, 0x00, 0x06, 0x0E, 0x05, 0x00, 0x07, 0x0E, 0x05, 0x00, 
+    0x07, 0x0E, 0x04, 0x00, 0x08, 0x0E, 0x04, 0x00, 0x08, 0x0E, 0x03, 0x00, 
+    0x09, 0x0E, 0x81, 0x00, 0x19, 0x0E, 
 };
 
 
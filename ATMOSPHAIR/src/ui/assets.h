@@ -43,8 +43,8 @@
 
 //* _ EXTERN ASSETS DECLARATIONS _______________________________________________
 
-extern const uint8_t    MENU_LEFT_ASSET[];
-extern const uint8_t    MENU_RIGHT_ASSET[];
+extern const uint8_t    MENU_LEFT_ASSET[];    ///< RLE encoded. 
+extern const uint8_t    MENU_RIGHT_ASSET[];   ///< RLE encoded. 
 extern const uint8_t    SETTINGS_ACTION_ASSET[]; 
 extern const uint8_t   SETTINGS_ACTION_SELECTED_ASSET[]; 
 
@@ -89,6 +89,21 @@ static const PAGE_t PAGES_LUT[] = {
             .measure_widget = &(MEASURE_WIDGET_LUT[WIDGET_BATTERY_CHARGE]), 
         }, 
     }, 
+    {
+        .left_widget  = &(const WIDGET_t){
+            .type           = WIDGET_CHART, 
+            .chart_widget   = &(CHART_WIDGET_LUT[CHART_WIDGET_PM_2_5]), 
+        },
+        .right_widget = &(const WIDGET_t){
+            .type           = WIDGET_CHART, 
+            .chart_widget   = &(CHART_WIDGET_LUT[CHART_WIDGET_CO2]), 
+        }, 
+    }, 
+    {
+        .left_widget  = &(const WIDGET_t){
+            .type           = WIDGET_DIAGNOSTICS, 
+        },
+    }, 
     {
         .left_widget  = &(const WIDGET_t){
             .type           = WIDGET_SETTINGS, 
@@ -98,71 +113,84 @@ static const PAGE_t PAGES_LUT[] = {
 };
 
 
+// Page and widgets currently on screen, PAGE_COUNT forces a full redraw. 
+static PAGE_INDEX_t  drawn_page = PAGE_COUNT; 
+static WIDGET_SLOT_t left_slot  = {.x = LEFT_WIDGET_X_POS,  .y = LEFT_WIDGET_Y_POS}; 
+static WIDGET_SLOT_t right_slot = {.x = RIGHT_WIDGET_X_POS, .y = RIGHT_WIDGET_Y_POS}; 
+
+// Boot step currently on screen, UINT32_MAX forces a full redraw. 
+static uint32_t      drawn_boot_step = UINT32_MAX; 
+
+
+// _ STATIC FUNCTION DECLARATIONS ______________________________________________
+
+/// @fn static bool page_is_available(PAGE_INDEX_t page); 
+/// @brief tells if the page shows at least one widget on the detected sensor. 
+static bool page_is_available(PAGE_INDEX_t page); 
+
+
 void display_page(void)
 {
     // If the requested page doesn't exist, reset the page queue. 
     if (curr_page >= ARRAY_SIZE(PAGES_LUT))
         curr_page = PAGE_1; 
     
-    const WIDGET_t* left_widget = PAGES_LUT[curr_page].left_widget; 
-    const WIDGET_t* right_widget = PAGES_LUT[curr_page].right_widget; 
-
-    // Check if a left widget is defined in this page, if so, draws it using the
-    // correct drawing funtions depending on it's type. 
-    if (left_widget)
-    {
-        switch (left_widget->type)
-        {
-            case WIDGET_MEASUREMENT:
-                draw_measurement_widget(
-                    LEFT_WIDGET_X_POS, 
-                    LEFT_WIDGET_Y_POS, 
-                    left_widget->measure_widget
-                ); 
-                break; 
-            case WIDGET_SETTINGS: 
-                draw_settings_widget(
-                    LEFT_WIDGET_X_POS, 
-                    LEFT_WIDGET_Y_POS, 
-                    left_widget->settings_widget
-                ); 
-                break; 
-            
-            default: 
-                break; 
-        }
-    }
+    // Don't show a page the sensor has nothing to display on. 
+    if (!page_is_available(curr_page))
+        page_scroll(); 
     
-    // Same here for the right widget. Settings widget can't be rendered on the 
-    // right because they're full screen. 
-    if (right_widget)
-    {
-        switch (right_widget->type)
-        {
-            case WIDGET_MEASUREMENT:
-                draw_measurement_widget(
-                    RIGHT_WIDGET_X_POS, 
-                    RIGHT_WIDGET_Y_POS, 
-                    right_widget->measure_widget
-                ); 
-                break; 
-            case WIDGET_SETTINGS: 
-            default: 
-                break; 
-        }
+    // A new page can have widgets of different sizes, erase the whole page 
+    // area and redraw every widget. 
+    if (curr_page != drawn_page)
+    {
+        display_draw_fillrect(
+            LEFT_WIDGET_X_POS, LEFT_WIDGET_Y_POS, 
+            PAGE_WIDTH, PAGE_HEIGHT, 
+            MIN_INTENSITY
+        ); 
+        left_slot.widget  = NULL; 
+        right_slot.widget = NULL; 
+        drawn_page        = curr_page; 
     }
     
+    // Widgets are only redrawn when their value changed. Settings and 
+    // diagnostics widgets can't be rendered on the right because they're 
+    // full screen. 
+    draw_widget_slot(&left_slot, PAGES_LUT[curr_page].left_widget); 
+    
+    if (!PAGES_LUT[curr_page].right_widget 
+            || (PAGES_LUT[curr_page].right_widget->type != WIDGET_SETTINGS 
+                && PAGES_LUT[curr_page].right_widget->type != WIDGET_DIAGNOSTICS))
+        draw_widget_slot(&right_slot, PAGES_LUT[curr_page].right_widget); 
+    
+    return; 
+}
+
+
+void page_invalidate(void)
+{
+    drawn_page = PAGE_COUNT; 
     return; 
 }
 
 
 void page_scroll(void)
 {
-    curr_page += 1; 
+    uint32_t i; 
     
-    // If the requested page doesn't exist, reset the page queue. 
-    if (curr_page >= ARRAY_SIZE(PAGES_LUT))
-        curr_page = PAGE_1; 
+    // Skip the pages whose measurements aren't provided by the sensor, the 
+    // settings page is always available so the loop ends. 
+    for (i = 0; i < ARRAY_SIZE(PAGES_LUT); i += 1)
+    {
+        curr_page += 1; 
+        
+        // If the requested page doesn't exist, reset the page queue. 
+        if (curr_page >= ARRAY_SIZE(PAGES_LUT))
+            curr_page = PAGE_1; 
+        
+        if (page_is_available(curr_page))
+            break; 
+    }
         
     return; 
 }
@@ -188,4 +216,57 @@ void page_interact(void)
     }
 
     return; 
-}
\ No newline at end of file
+}
+
+
+void display_boot_page(const BOOT_STEP_t* steps, uint32_t step_count, uint32_t curr_step)
+{
+    if (curr_step == drawn_boot_step || curr_step >= step_count)
+        return; 
+    
+    if (drawn_boot_step == UINT32_MAX)
+    {
+        display_fill(MIN_INTENSITY); 
+        display_draw_str(
+            (DISPLAY_WIDTH - strlen(BOOT_TITLE) * FONT_10X12_WIDTH) / 2, 
+            BOOT_TITLE_Y_POS, 
+            BOOT_TITLE, 
+            MAX_INTENSITY, 
+            FONT_10X16_BOLD
+        ); 
+        display_draw_rect(
+            BOOT_BAR_X_POS, BOOT_BAR_Y_POS, 
+            BOOT_BAR_WIDTH, BOOT_BAR_HEIGHT, 
+            MAX_INTENSITY
+        ); 
+    }
+    
+    // Name of the running step. 
+    display_draw_fillrect(0, BOOT_STEP_Y_POS, DISPLAY_WIDTH, FONT_10X12_HEIGHT, MIN_INTENSITY); 
+    display_draw_str(
+        (DISPLAY_WIDTH - strlen(steps[curr_step].name) * FONT_6X8_WIDTH) / 2, 
+        BOOT_STEP_Y_POS, 
+        steps[curr_step].name, 
+        HALF_INTENSITY, 
+        FONT_6X8
+    ); 
+    
+    // The bar is filled with the completed steps. 
+    display_draw_fillrect(
+        BOOT_BAR_X_POS + 2, BOOT_BAR_Y_POS + 2, 
+        (BOOT_BAR_WIDTH - 4) * curr_step / step_count, BOOT_BAR_HEIGHT - 4, 
+        MAX_INTENSITY
+    ); 
+    
+    drawn_boot_step = curr_step; 
+    return; 
+}
+
+
+// _ STATIC FUNCTION IMPLEMENTATIONS ___________________________________________
+
+static bool page_is_available(PAGE_INDEX_t page)
+{
+    return widget_is_available(PAGES_LUT[page].left_widget) 
+        || widget_is_available(PAGES_LUT[page].right_widget); 
+}
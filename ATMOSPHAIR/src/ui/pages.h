@@ -15,6 +15,16 @@
 #define LEFT_WIDGET_Y_POS   1
 #define RIGHT_WIDGET_X_POS  138
 #define RIGHT_WIDGET_Y_POS  1
+#define PAGE_WIDTH          (RIGHT_WIDGET_X_POS + MEASURE_WIDGET_WIDTH - LEFT_WIDGET_X_POS)
+#define PAGE_HEIGHT         MEASURE_WIDGET_HEIGHT
+
+#define BOOT_TITLE          "ATMOSPHAIR"
+#define BOOT_TITLE_Y_POS    4
+#define BOOT_STEP_Y_POS     28
+#define BOOT_BAR_X_POS      28
+#define BOOT_BAR_Y_POS      44
+#define BOOT_BAR_WIDTH      200
+#define BOOT_BAR_HEIGHT     8
         
 //* _ ENUMERATIONS _____________________________________________________________
 
@@ -30,6 +40,8 @@ typedef enum page_index
     PAGE_8, 
     PAGE_9, 
     PAGE_10, 
+    PAGE_11, 
+    PAGE_12, 
     PAGE_COUNT, 
 }   PAGE_INDEX_t;
 
@@ -43,13 +55,31 @@ typedef struct page
 }   PAGE_t;
 
 
+/// @struct BOOT_STEP_t
+/// @brief one step of the boot sequence, polled by the main loop until the 
+///        module driving it reports it done or the step times out. 
+typedef struct boot_step
+{
+    const char* name;               ///< Shown on the boot screen. 
+    bool        (*is_done)(void);   ///< Returns true once the step completed. 
+    uint32_t    timeout_ms;         ///< The boot goes on without the step after this delay. 
+}   BOOT_STEP_t;
+
+
 //* _ FUNCTION DECLARATIONS ____________________________________________________
 
 /// @fn void display_page(PAGE_INDEX_t page_index); 
 /// @brief display a page composed of either one or two widget on the screen. 
+///        Only the widgets whose value changed since the last call are redrawn. 
 void display_page(void); 
 
 
+/// @fn void page_invalidate(void); 
+/// @brief forces the whole page to be redrawn on the next call to display_page, 
+///        use it after clearing the screen. 
+void page_invalidate(void); 
+
+
 /// @fn void page_increment(void); 
 /// @brief increment the current page index, scroll throught each page. 
 void page_scroll(void); 
@@ -57,4 +87,13 @@ void page_scroll(void);
 
 void page_interact(void); 
 
+
+/// @fn void display_boot_page(const BOOT_STEP_t* steps, uint32_t step_count, uint32_t curr_step); 
+/// @brief full screen boot progress, the running step name above a progress 
+///        bar. Only redrawn when the step changes. 
+/// @param steps boot sequence. 
+/// @param step_count number of steps of the sequence. 
+/// @param curr_step index of the running step. 
+void display_boot_page(const BOOT_STEP_t* steps, uint32_t step_count, uint32_t curr_step); 
+
 #endif
@@ -7,121 +7,121 @@ const MEASURE_WIDGET_t MEASURE_WIDGET_LUT[] = {
         .title                = "PM 0.5", 
         .icon                 = PM_ICON_ASSET, 
         .icon_size            = WIDGET_ICON_SIZE, 
-        .val_type             = FLOAT,
+        .val_type             = FIXED_POINT,
         .unit                 = "uG/m3", 
-        .measurement.as_float = &(SEN6X_data.PM_0_5),
+        .measurement.as_fixed = &(SEN6X_data.PM_0_5),
     }, 
     {
         .title                = "PM 1.0", 
         .icon                 = PM_ICON_ASSET,
         .icon_size            = WIDGET_ICON_SIZE, 
-        .val_type             = FLOAT,
+        .val_type             = FIXED_POINT,
         .unit                 = "uG/m3", 
-        .measurement.as_float = &(SEN6X_data.PM_1_0),
+        .measurement.as_fixed = &(SEN6X_data.PM_1_0),
     }, 
     {
         .title                = "PM 2.5", 
         .icon                 = PM_ICON_ASSET,
         .icon_size            = WIDGET_ICON_SIZE, 
-        .val_type             = FLOAT,
+        .val_type             = FIXED_POINT,
         .unit                 = "uG/m3", 
-        .measurement.as_float = &(SEN6X_data.PM_2_5),
+        .measurement.as_fixed = &(SEN6X_data.PM_2_5),
     }, 
     {
         .title                = "PM 4.0", 
         .icon                 = PM_ICON_ASSET,
         .icon_size            = WIDGET_ICON_SIZE, 
-        .val_type             = FLOAT,
+        .val_type             = FIXED_POINT,
         .unit                 = "uG/m3", 
-        .measurement.as_float = &(SEN6X_data.PM_4_0),
+        .measurement.as_fixed = &(SEN6X_data.PM_4_0),
     }, 
     {
         .title                = "PM 10.0", 
         .icon                 = PM_ICON_ASSET,
         .icon_size            = WIDGET_ICON_SIZE, 
-        .val_type             = FLOAT,
+        .val_type             = FIXED_POINT,
         .unit                 = "uG/m3", 
-        .measurement.as_float = &(SEN6X_data.PM_10_0),
+        .measurement.as_fixed = &(SEN6X_data.PM_10_0),
     }, 
     {
         .title                = "TEMP", 
         .icon                 = TEMP_ICON_ASSET,
         .icon_size            = WIDGET_ICON_SIZE, 
-        .val_type             = FLOAT,
+        .val_type             = FIXED_POINT,
         .unit                 = "C", 
-        .measurement.as_float = &(SEN6X_data.temp),
+        .measurement.as_fixed = &(SEN6X_data.temp),
     }, 
     {
         .title                = "HUMIDITY", 
         .icon                 = RH_ICON_ASSET,
         .icon_size            = WIDGET_ICON_SIZE, 
-        .val_type             = FLOAT,
+        .val_type             = FIXED_POINT,
         .unit                 = "%", 
-        .measurement.as_float = &(SEN6X_data.humidity),
+        .measurement.as_fixed = &(SEN6X_data.humidity),
     }, 
     {
         .title                = "VOC", 
         .icon                 = VOC_ICON_ASSET,
         .icon_size            = WIDGET_ICON_SIZE, 
-        .val_type             = FLOAT,
+        .val_type             = FIXED_POINT,
         .unit                 = "INDEX", 
-        .measurement.as_float = &(SEN6X_data.VOC),
+        .measurement.as_fixed = &(SEN6X_data.VOC),
     }, 
     {
         .title                = "NOx", 
         .icon                 = NOX_ICON_ASSET,
         .icon_size            = WIDGET_ICON_SIZE, 
-        .val_type             = FLOAT,
+        .val_type             = FIXED_POINT,
         .unit                 = "INDEX", 
-        .measurement.as_float = &(SEN6X_data.NOx),
+        .measurement.as_fixed = &(SEN6X_data.NOx),
     }, 
     {
         .title                = "CO2", 
         .icon                 = CO2_H2S_ICON_ASSET,
         .icon_size            = WIDGET_ICON_SIZE, 
-        .val_type             = FLOAT,
+        .val_type             = FIXED_POINT,
         .unit                 = "PPM", 
-        .measurement.as_float = &(SEN6X_data.CO2),
+        .measurement.as_fixed = &(SEN6X_data.CO2),
     }, 
     {
         .title                = "HCHO", 
         .icon                 = NULL,
         .icon_size            = WIDGET_ICON_SIZE, 
-        .val_type             = FLOAT,
+        .val_type             = FIXED_POINT,
         .unit                 = "PPB", 
-        .measurement.as_float = &(SEN6X_data.HCHO),
+        .measurement.as_fixed = &(SEN6X_data.HCHO),
     }, 
     {
         .title              = "H2S", 
         .icon               = CO2_H2S_ICON_ASSET,
         .icon_size          = WIDGET_ICON_SIZE, 
-        .val_type           = INTEGER,
+        .val_type           = FIXED_POINT,
         .unit               = "PPM", 
-        .measurement.as_int = &(ADC_data[ADC_HS2].data),
+        .measurement.as_fixed = &(processed_data[ADC_H2S]),
     }, 
     {
         .title              = "O2", 
         .icon               = O2_ICON_ASSET,
         .icon_size          = WIDGET_ICON_SIZE, 
-        .val_type           = FLOAT,
+        .val_type           = FIXED_POINT,
         .unit               = "PPM", 
-        .measurement.as_float = &(processed_data[ADC_O2].data),
+        .measurement.as_fixed = &(processed_data[ADC_O2]),
     }, 
     {
         .title              = "CO", 
         .icon               = CO_ICON_ASSET,
         .icon_size          = WIDGET_ICON_SIZE, 
-        .val_type           = INTEGER,
+        .val_type           = FIXED_POINT,
         .unit               = "PPM", 
-        .measurement.as_int = &(ADC_data[ADC_CO].data),
+        .measurement.as_fixed = &(processed_data[ADC_CO]),
     }, 
     {
         .title              = "GASES", 
         .icon               = FLAMMABLE_GASES_ICON_ASSET,
         .icon_size          = WIDGET_ICON_SIZE, 
-        .val_type           = INTEGER,
+        .val_type           = FIXED_POINT,
         .unit               = "PPM", 
-        .measurement.as_int = &(ADC_data[ADC_FLAMMABLE_GASES].data),
+        .measurement.as_fixed = &(processed_data[ADC_FLAMMABLE_GASES]),
     }, 
     {
         .title              = "BATTERY", 
@@ -149,6 +149,61 @@ const SETTING_WIDGET_t SETTINGS_WIDGET_LUT[] = {
 }; 
 
 
+const CHART_WIDGET_t CHART_WIDGET_LUT[] = {
+    {
+        .source = &(MEASURE_WIDGET_LUT[WIDGET_PM_2_5]), 
+        .metric = HISTORY_PM_2_5, 
+        .tier   = HISTORY_TIER_1S, 
+        .period = "1 S", 
+    }, 
+    {
+        .source = &(MEASURE_WIDGET_LUT[WIDGET_CO2]), 
+        .metric = HISTORY_CO2, 
+        .tier   = HISTORY_TIER_5MIN, 
+        .period = "5 MIN", 
+    }, 
+}; 
+
+
+// Counters listed by the diagnostics widget. 
+static const DIAG_COUNTER_t DIAG_COUNTER_LUT[] = {
+    #define X(field, label, key)    {label, &SEN6X_diag.field}, 
+        SEN6X_DIAG_COUNTERS
+    #undef X
+}; 
+
+
+static MENU_WIDGET_STATE_t menu_state = {0}; 
+
+// Buckets being plotted, shared by every chart. 
+static HISTORY_BUCKET_t    chart_buckets[CHART_COLUMN_COUNT]; 
+
+
+// _ STATIC FUNCTION DECLARATIONS ______________________________________________
+
+static bool widget_value_get(const WIDGET_t* widget, WIDGET_VALUE_t* value); 
+
+/// @fn static bool measure_widget_is_available(const MEASURE_WIDGET_t* measure_widget); 
+/// @brief tells if the sensor provides the measurement of the widget. 
+static bool measure_widget_is_available(const MEASURE_WIDGET_t* measure_widget); 
+
+/// @fn static int32_t chart_row(const CHART_STATE_t* state, int32_t value); 
+/// @brief row of a value relative to the widget, the max is on the first 
+///        row of the plot. 
+static int32_t chart_row(const CHART_STATE_t* state, int32_t value); 
+
+/// @fn static void chart_draw_column(uint32_t x, uint32_t y, const CHART_STATE_t* state, uint32_t sequence, const HISTORY_BUCKET_t* bucket); 
+/// @brief erases the column of a bucket and draws its min to max span as one 
+///        vertical span, the mean brighter. 
+/// @param sequence history sequence of the bucket, gives its column. 
+static void chart_draw_column(uint32_t x, uint32_t y, const CHART_STATE_t* state, uint32_t sequence, const HISTORY_BUCKET_t* bucket); 
+
+/// @fn static uint32_t chart_label_to_str(char* buffer, uint32_t size, const MEASURE_WIDGET_t* source, int32_t value); 
+/// @brief writes an axis value in the unit of the plotted measurement. 
+/// @return the length of the string. 
+static uint32_t chart_label_to_str(char* buffer, uint32_t size, const MEASURE_WIDGET_t* source, int32_t value); 
+
+
 void draw_menu_widget(uint32_t x, uint32_t y, uint32_t battery_percent)
 {
     uint32_t    battery_level; 
@@ -163,9 +218,27 @@ void draw_menu_widget(uint32_t x, uint32_t y, uint32_t battery_percent)
     is_server_connected = MQTT_status.mqtt_is_conn && MQTT_status.mqtt_is_open; 
     network_strength    = (M95_status.signal_strength * MAX_NETWORK_STRENGTH) / MAX_RSSI_VAL; 
     
+    // Nothing changed since the last drawn menu, keep it. 
+    if (menu_state.is_valid 
+            && menu_state.battery_percent     == battery_percent 
+            && menu_state.network_strength    == network_strength 
+            && menu_state.is_warn_triggered   == is_warn_triggered 
+            && menu_state.is_server_connected == is_server_connected 
+            && menu_state.speaker_is_active   == speaker_is_active)
+        return; 
+    
+    menu_state.is_valid            = true; 
+    menu_state.battery_percent     = battery_percent; 
+    menu_state.network_strength    = network_strength; 
+    menu_state.is_warn_triggered   = is_warn_triggered; 
+    menu_state.is_server_connected = is_server_connected; 
+    menu_state.speaker_is_active   = speaker_is_active; 
+    
+    // Menu images cover the whole menu area so they also erase the previous 
+    // indicators. 
     // Draw left, right menu and horizontal bars. 
-    display_img(x, y, MENU_LEFT_WIDTH, MENU_LEFT_HEIGHT, MENU_LEFT_ASSET); 
-    display_img(x + DISPLAY_WIDTH - MENU_RIGHT_WIDTH, y, MENU_RIGHT_WIDTH, MENU_RIGHT_HEIGHT, MENU_RIGHT_ASSET); 
+    display_img_rle(x, y, MENU_LEFT_WIDTH, MENU_LEFT_HEIGHT, MENU_LEFT_ASSET); 
+    display_img_rle(x + DISPLAY_WIDTH - MENU_RIGHT_WIDTH, y, MENU_RIGHT_WIDTH, MENU_RIGHT_HEIGHT, MENU_RIGHT_ASSET); 
     display_fast_h_line(x, y, DISPLAY_WIDTH, MAX_INTENSITY); 
     display_fast_h_line(x, y + DISPLAY_HEIGHT - 1, DISPLAY_WIDTH, MAX_INTENSITY); 
     
@@ -197,6 +270,13 @@ void draw_menu_widget(uint32_t x, uint32_t y, uint32_t battery_percent)
 }
 
 
+void menu_widget_invalidate(void)
+{
+    menu_state.is_valid = false; 
+    return; 
+}
+
+
 void draw_measurement_widget(uint32_t x, uint32_t y, const MEASURE_WIDGET_t* measure_widget)
 { 
     uint32_t            value_len; 
@@ -211,10 +291,21 @@ void draw_measurement_widget(uint32_t x, uint32_t y, const MEASURE_WIDGET_t* mea
     // Get the length of strings that will be drawn onto the screen, used to 
     // center those strings. 
     if (measure_widget->val_type == FLOAT)
-        value_len = sprintf(buffer, "%." DECIMAL_COUNT "f", *(measure_widget->measurement.as_float));
+        value_len = float_to_str(buffer, sizeof(buffer), *(measure_widget->measurement.as_float), DECIMAL_COUNT);
     
     else if (measure_widget->val_type == INTEGER)
-        value_len = sprintf(buffer, "%d", *(measure_widget->measurement.as_int));
+        value_len = fixed_to_str(buffer, sizeof(buffer), *(measure_widget->measurement.as_int), 0);
+    
+    else if (measure_widget->val_type == FIXED_POINT && measure_widget->measurement.as_fixed->is_valid)
+        value_len = measurement_to_str(buffer, sizeof(buffer), measure_widget->measurement.as_fixed, DECIMAL_COUNT);
+    
+    // A measurement without a valid value in the last sample, or of an 
+    // unknown type, is shown as a placeholder. 
+    else
+    {
+        strcpy(buffer, NO_VALUE_STR); 
+        value_len = strlen(NO_VALUE_STR); 
+    }
 
     unit_len = strlen(measure_widget->unit); 
     
@@ -254,6 +345,17 @@ void draw_measurement_widget(uint32_t x, uint32_t y, const MEASURE_WIDGET_t* mea
         MAX_INTENSITY, 
         FONT_6X8
     ); 
+    
+    // A value converted without calibration is only indicative. 
+    if (measure_widget->val_type == FIXED_POINT && measure_widget->measurement.as_fixed->is_nominal)
+        display_draw_str(
+            x + 2, 
+            MEASURE_WIDGET_HEIGHT / 2 + (FONT_10X12_HEIGHT / 2) + 2,
+            UNCALIBRATED_STR, 
+            HALF_INTENSITY, 
+            FONT_6X8
+        ); 
+    
     return; 
 }
 
@@ -293,4 +395,393 @@ void draw_settings_widget(uint32_t x, uint32_t y, const SETTING_WIDGET_t* widget
         y + FONT_10X12_HEIGHT + widget->action.icon_size + 4, 
         widget->action.name, MAX_INTENSITY, FONT_10X16
     ); 
-}
\ No newline at end of file
+}
+
+
+void draw_chart_widget(uint32_t x, uint32_t y, const CHART_WIDGET_t* chart_widget, CHART_STATE_t* state)
+{
+    char        buffer[16]; 
+    uint32_t    count; 
+    uint32_t    len; 
+    uint32_t    i; 
+    int32_t     margin; 
+    bool        has_value; 
+    
+    // If no widget is given, abort. 
+    if (!chart_widget)
+        return; 
+    
+    
+    count           = HISTORY_read(chart_widget->metric, chart_widget->tier, chart_buckets, CHART_COLUMN_COUNT); 
+    state->sequence = HISTORY_sequence(chart_widget->tier); 
+    
+    // Scale the axes to the plotted buckets. 
+    has_value = false; 
+    for (i = 0; i < count; i += 1)
+    {
+        if (chart_buckets[i].is_empty)
+            continue; 
+        
+        if (!has_value || chart_buckets[i].min < state->min)
+            state->min = chart_buckets[i].min; 
+        
+        if (!has_value || chart_buckets[i].max > state->max)
+            state->max = chart_buckets[i].max; 
+        
+        has_value = true; 
+    }
+    
+    // Nothing to plot yet, any bucket will be out of the axes and rescale 
+    // them. Otherwise keep some headroom so a slow drift doesn't rescale the 
+    // chart on every bucket, a flat signal is centered. 
+    if (!has_value)
+    {
+        state->min = INT32_MAX; 
+        state->max = INT32_MIN; 
+    }
+    
+    else
+    {
+        margin      = (state->max - state->min) / CHART_SCALE_MARGIN + 1; 
+        state->min -= margin; 
+        state->max += margin; 
+    }
+    
+    // Draw the title and the top of the axis. 
+    display_draw_str(x, y, chart_widget->source->title, MAX_INTENSITY, FONT_6X8); 
+    
+    if (has_value)
+        len = chart_label_to_str(buffer, sizeof(buffer), chart_widget->source, state->max); 
+    
+    else
+    {
+        strcpy(buffer, NO_VALUE_STR); 
+        len = strlen(NO_VALUE_STR); 
+    }
+    
+    display_draw_str(x + CHART_WIDGET_WIDTH - len * FONT_6X8_WIDTH, y, buffer, HALF_INTENSITY, FONT_6X8); 
+    
+    // Draw the axes. 
+    display_fast_v_line(x, y + CHART_PLOT_Y_OFFSET, CHART_PLOT_HEIGHT + 1, QUARTER_INTENSITY); 
+    display_fast_h_line(x, y + CHART_PLOT_Y_OFFSET + CHART_PLOT_HEIGHT, CHART_WIDGET_WIDTH, QUARTER_INTENSITY); 
+    
+    // Draw the column period and the bottom of the axis. 
+    display_draw_str(x, y + CHART_LABEL_Y_OFFSET, chart_widget->period, HALF_INTENSITY, FONT_6X8); 
+    
+    if (has_value)
+    {
+        len = chart_label_to_str(buffer, sizeof(buffer), chart_widget->source, state->min); 
+        display_draw_str(
+            x + CHART_WIDGET_WIDTH - len * FONT_6X8_WIDTH, 
+            y + CHART_LABEL_Y_OFFSET, 
+            buffer, 
+            HALF_INTENSITY, 
+            FONT_6X8
+        ); 
+    }
+    
+    // Buckets are placed by their sequence, the cursor stays on the same 
+    // column between redraws. 
+    for (i = 0; i < count; i += 1)
+        chart_draw_column(x, y, state, state->sequence - count + i, &chart_buckets[i]); 
+    
+    return; 
+}
+
+
+void update_chart_widget(uint32_t x, uint32_t y, const CHART_WIDGET_t* chart_widget, CHART_STATE_t* state)
+{
+    uint32_t    sequence; 
+    uint32_t    count; 
+    uint32_t    i; 
+    bool        is_full_redraw; 
+    
+    // If no widget is given, abort. 
+    if (!chart_widget)
+        return; 
+    
+    
+    sequence = HISTORY_sequence(chart_widget->tier); 
+    if (sequence == state->sequence)
+        return; 
+    
+    // Too many buckets to append, or the cursor wrapped around: rescale the 
+    // axes to the buckets still plotted. 
+    count          = sequence - state->sequence; 
+    is_full_redraw = count > CHART_COLUMN_COUNT 
+        || sequence / CHART_PLOT_WIDTH != state->sequence / CHART_PLOT_WIDTH; 
+    
+    if (!is_full_redraw)
+    {
+        count = HISTORY_read(chart_widget->metric, chart_widget->tier, chart_buckets, count); 
+        
+        for (i = 0; i < count && !is_full_redraw; i += 1)
+            is_full_redraw = !chart_buckets[i].is_empty 
+                && (chart_buckets[i].min < state->min || chart_buckets[i].max > state->max); 
+    }
+    
+    if (is_full_redraw)
+    {
+        display_draw_fillrect(x, y, CHART_WIDGET_WIDTH, CHART_WIDGET_HEIGHT, MIN_INTENSITY); 
+        draw_chart_widget(x, y, chart_widget, state); 
+        return; 
+    }
+    
+    // Only the new columns are drawn, then the columns ahead of the cursor 
+    // are erased to show where the sweep is. 
+    for (i = 0; i < count; i += 1)
+        chart_draw_column(x, y, state, sequence - count + i, &chart_buckets[i]); 
+    
+    for (i = 0; i < CHART_CURSOR_GAP; i += 1)
+        chart_draw_column(x, y, state, sequence + i, &(const HISTORY_BUCKET_t){.is_empty = true}); 
+    
+    state->sequence = sequence; 
+    return; 
+}
+
+
+void draw_diagnostics_widget(uint32_t x, uint32_t y)
+{
+    uint32_t    cell_x; 
+    uint32_t    cell_y; 
+    uint32_t    i; 
+    const char* model_name; 
+    
+    model_name = SEN6X_model ? SEN6X_model->name : NO_VALUE_STR; 
+    
+    display_draw_str(x, y, "DIAGNOSTICS", MAX_INTENSITY, FONT_10X16_BOLD); 
+    display_draw_str(
+        x + DIAG_WIDGET_WIDTH - strlen(model_name) * FONT_6X8_WIDTH, y + 4, 
+        model_name, HALF_INTENSITY, FONT_6X8
+    ); 
+    
+    // Counters are listed top to bottom, then on the right column. 
+    for (i = 0; i < ARRAY_SIZE(DIAG_COUNTER_LUT); i += 1)
+    {
+        cell_x = x + (i / DIAG_ROW_COUNT) * DIAG_COLUMN_WIDTH; 
+        cell_y = y + DIAG_ROW_Y_OFFSET + (i % DIAG_ROW_COUNT) * DIAG_ROW_HEIGHT; 
+        
+        display_draw_str(cell_x, cell_y, DIAG_COUNTER_LUT[i].label, HALF_INTENSITY, FONT_6X8); 
+        display_printf(
+            cell_x + DIAG_VALUE_X_OFFSET, cell_y, MAX_INTENSITY, FONT_6X8, 
+            "%lu", (unsigned long)*(DIAG_COUNTER_LUT[i].count)
+        ); 
+    }
+    
+    return; 
+}
+
+
+bool widget_is_available(const WIDGET_t* widget)
+{
+    if (!widget)
+        return false; 
+    
+    // A chart is available with the measurement it plots. 
+    if (widget->type == WIDGET_MEASUREMENT)
+        return measure_widget_is_available(widget->measure_widget); 
+    
+    else if (widget->type == WIDGET_CHART)
+        return measure_widget_is_available(widget->chart_widget->source); 
+    
+    return true; 
+}
+
+
+void draw_widget_slot(WIDGET_SLOT_t* slot, const WIDGET_t* widget)
+{
+    WIDGET_VALUE_t  value; 
+    bool            has_value; 
+    
+    // A measurement the sensor doesn't provide leaves its slot empty. 
+    if (!widget_is_available(widget))
+        widget = NULL; 
+    
+    // A chart keeps what it plotted and only appends the new buckets. 
+    if (widget && slot->widget == widget && widget->type == WIDGET_CHART)
+    {
+        update_chart_widget(slot->x, slot->y, widget->chart_widget, &slot->value.as_chart); 
+        return; 
+    }
+    
+    has_value = widget_value_get(widget, &value); 
+    
+    // Same widget with the same value, what is on screen is still valid. A 
+    // widget without a value, like the settings, can't tell and is always 
+    // repainted, the rows that didn't change are trimmed from the transfer. 
+    if (widget && slot->widget == widget && has_value)
+    {
+        if (widget->type == WIDGET_DIAGNOSTICS)
+        {
+            if (value.as_count == slot->value.as_count)
+                return; 
+        }
+        
+        else if (widget->measure_widget->val_type == FLOAT 
+                && value.as_float == slot->value.as_float)
+            return; 
+        
+        else if (widget->measure_widget->val_type == INTEGER 
+                && value.as_int == slot->value.as_int)
+            return; 
+        
+        else if (widget->measure_widget->val_type == FIXED_POINT 
+                && value.as_fixed.raw == slot->value.as_fixed.raw 
+                && value.as_fixed.divider == slot->value.as_fixed.divider 
+                && value.as_fixed.is_valid == slot->value.as_fixed.is_valid)
+            return; 
+    }
+    
+    slot->widget = widget; 
+    slot->value  = value; 
+    
+    if (!widget)
+        return; 
+    
+    // Erase the previous content of the slot and draw the widget. 
+    switch (widget->type)
+    {
+        case WIDGET_MEASUREMENT:
+            display_draw_fillrect(
+                slot->x, slot->y, 
+                MEASURE_WIDGET_WIDTH, MEASURE_WIDGET_HEIGHT, 
+                MIN_INTENSITY
+            ); 
+            draw_measurement_widget(slot->x, slot->y, widget->measure_widget); 
+            break; 
+            
+        case WIDGET_SETTINGS: 
+            display_draw_fillrect(
+                slot->x, slot->y, 
+                SETTINGS_WIDGET_WIDTH, SETTINGS_WIDGET_HEIGHT, 
+                MIN_INTENSITY
+            ); 
+            draw_settings_widget(slot->x, slot->y, widget->settings_widget); 
+            break; 
+            
+        case WIDGET_CHART: 
+            display_draw_fillrect(
+                slot->x, slot->y, 
+                CHART_WIDGET_WIDTH, CHART_WIDGET_HEIGHT, 
+                MIN_INTENSITY
+            ); 
+            draw_chart_widget(slot->x, slot->y, widget->chart_widget, &slot->value.as_chart); 
+            break; 
+            
+        case WIDGET_DIAGNOSTICS: 
+            display_draw_fillrect(
+                slot->x, slot->y, 
+                DIAG_WIDGET_WIDTH, DIAG_WIDGET_HEIGHT, 
+                MIN_INTENSITY
+            ); 
+            draw_diagnostics_widget(slot->x, slot->y); 
+            break; 
+            
+        default: 
+            break; 
+    }
+    
+    return; 
+}
+
+
+// _ STATIC FUNCTION IMPLEMENTATIONS ___________________________________________
+
+static bool widget_value_get(const WIDGET_t* widget, WIDGET_VALUE_t* value)
+{
+    const MEASURE_WIDGET_t* measure_widget; 
+    
+    value->as_fixed = (MEASUREMENT_t){0}; 
+    
+    // Counters only increase, their sum changes with any of them. 
+    if (widget && widget->type == WIDGET_DIAGNOSTICS)
+    {
+        value->as_count = 0; 
+        #define X(field, label, key)    value->as_count += SEN6X_diag.field; 
+            SEN6X_DIAG_COUNTERS
+        #undef X
+        return true; 
+    }
+    
+    // Only measurement widgets display a changing value. 
+    if (!widget || widget->type != WIDGET_MEASUREMENT || !widget->measure_widget)
+        return false; 
+    
+    measure_widget = widget->measure_widget; 
+    
+    if (measure_widget->val_type == FLOAT)
+        value->as_float = *(measure_widget->measurement.as_float); 
+    
+    else if (measure_widget->val_type == INTEGER)
+        value->as_int = *(measure_widget->measurement.as_int); 
+    
+    else if (measure_widget->val_type == FIXED_POINT)
+        value->as_fixed = *(measure_widget->measurement.as_fixed); 
+    
+    else
+        return false; 
+    
+    return true; 
+}
+
+
+static bool measure_widget_is_available(const MEASURE_WIDGET_t* measure_widget)
+{
+    // Only SEN6x measurements depend on the detected sensor model. 
+    if (measure_widget->val_type == FIXED_POINT)
+        return measure_widget->measurement.as_fixed->is_available; 
+    
+    return true; 
+}
+
+
+static int32_t chart_row(const CHART_STATE_t* state, int32_t value)
+{
+    if (value < state->min)
+        value = state->min; 
+    
+    if (value > state->max)
+        value = state->max; 
+    
+    return CHART_PLOT_Y_OFFSET + CHART_PLOT_HEIGHT - 1 
+        - (int32_t)(((int64_t)value - state->min) * (CHART_PLOT_HEIGHT - 1) / ((int64_t)state->max - state->min)); 
+}
+
+
+static void chart_draw_column(uint32_t x, uint32_t y, const CHART_STATE_t* state, uint32_t sequence, const HISTORY_BUCKET_t* bucket)
+{
+    uint32_t    column; 
+    int32_t     top; 
+    int32_t     bottom; 
+    
+    column = x + CHART_PLOT_X_OFFSET + sequence % CHART_PLOT_WIDTH; 
+    display_fast_v_line(column, y + CHART_PLOT_Y_OFFSET, CHART_PLOT_HEIGHT, MIN_INTENSITY); 
+    
+    // Nothing was measured during the bucket, leave a hole. 
+    if (bucket->is_empty)
+        return; 
+    
+    top    = chart_row(state, bucket->max); 
+    bottom = chart_row(state, bucket->min); 
+    
+    display_fast_v_line(column, y + top, bottom - top + 1, HALF_INTENSITY); 
+    display_set_pixel(column, y + chart_row(state, bucket->mean), MAX_INTENSITY); 
+    return; 
+}
+
+
+static uint32_t chart_label_to_str(char* buffer, uint32_t size, const MEASURE_WIDGET_t* source, int32_t value)
+{
+    MEASUREMENT_t measurement; 
+    
+    // History values are in sensor ticks for SEN6x measurements and in 
+    // conversion counts for the ADC channels. 
+    if (source->val_type != FIXED_POINT)
+        return fixed_to_str(buffer, size, value, 0); 
+    
+    measurement = (MEASUREMENT_t){
+        .raw     = value, 
+        .divider = source->measurement.as_fixed->divider, 
+    }; 
+    return measurement_to_str(buffer, size, &measurement, (measurement.divider > 1) ? 1 : 0); 
+}
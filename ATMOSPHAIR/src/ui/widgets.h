@@ -12,7 +12,9 @@
 #include "../drivers/sen6x.h"
 #include "../drivers/m95.h"
 #include "../cores/adc.h"
+#include "../processes/history.h"
 #include "../utils/adc_processing.h"
+#include "../utils/utils.h"
 
 //* _ DEFINITIONS ______________________________________________________________
 
@@ -28,13 +30,38 @@
 // Measure widget. 
 #define MEASURE_WIDGET_WIDTH        104
 #define MEASURE_WIDGET_HEIGHT       62
-#define DECIMAL_COUNT               "2"
+#define DECIMAL_COUNT               2
+#define NO_VALUE_STR                "--"
+#define UNCALIBRATED_STR            "UNCAL"
 
 
 // Settings widget. 
 #define SETTINGS_WIDGET_WIDTH       208
 #define SETTINGS_WIDGET_HEIGHT      62
-#define DECIMAL_COUNT               "2"
+
+
+// Chart widget, sweeps over the plot: the newest column is drawn at the 
+// cursor and the columns right after it are erased. 
+#define CHART_WIDGET_WIDTH          MEASURE_WIDGET_WIDTH
+#define CHART_WIDGET_HEIGHT         MEASURE_WIDGET_HEIGHT
+#define CHART_PLOT_X_OFFSET         1
+#define CHART_PLOT_Y_OFFSET         10
+#define CHART_PLOT_WIDTH            (CHART_WIDGET_WIDTH - CHART_PLOT_X_OFFSET)
+#define CHART_PLOT_HEIGHT           42
+#define CHART_LABEL_Y_OFFSET        (CHART_PLOT_Y_OFFSET + CHART_PLOT_HEIGHT + 2)
+#define CHART_CURSOR_GAP            2
+#define CHART_SCALE_MARGIN          8           // Headroom of 1/8 of the range on each side.
+#define CHART_COLUMN_COUNT          (CHART_PLOT_WIDTH - CHART_CURSOR_GAP)
+
+
+// Diagnostics widget, the SEN6x error counters on two columns. 
+#define DIAG_WIDGET_WIDTH           SETTINGS_WIDGET_WIDTH
+#define DIAG_WIDGET_HEIGHT          SETTINGS_WIDGET_HEIGHT
+#define DIAG_ROW_Y_OFFSET           18
+#define DIAG_ROW_HEIGHT             11
+#define DIAG_ROW_COUNT              4
+#define DIAG_COLUMN_WIDTH           (DIAG_WIDGET_WIDTH / 2)
+#define DIAG_VALUE_X_OFFSET         60
 
 //* _ ENUMERATION DECLARATIONS _________________________________________________
 
@@ -42,6 +69,8 @@ typedef enum widget_type
 {
     WIDGET_MEASUREMENT,  
     WIDGET_SETTINGS,  
+    WIDGET_CHART,  
+    WIDGET_DIAGNOSTICS,  
 }   WIDGET_TYPE_t;
 
 
@@ -67,10 +96,19 @@ typedef enum measure_widget_id
 }   MEASURE_WIDGET_ID_t;
 
 
+typedef enum chart_widget_id
+{
+    CHART_WIDGET_PM_2_5, 
+    CHART_WIDGET_CO2, 
+    CHART_WIDGET_COUNT, 
+}   CHART_WIDGET_ID_t;
+
+
 typedef enum measure_widget_val_type
 {
     FLOAT, 
     INTEGER, 
+    FIXED_POINT, 
     STRING, 
 }   MEASURE_WIDGET_VAL_TYPE_t;
 
@@ -90,6 +128,7 @@ typedef struct measure_widget
     {
         volatile float*             as_float; 
         volatile uint16_t*          as_int; 
+        const MEASUREMENT_t*        as_fixed; 
     }                               measurement;
 }   MEASURE_WIDGET_t;
 
@@ -114,6 +153,51 @@ typedef struct setting_widget
 }   SETTING_WIDGET_t;
 
 
+// _ chart widget ______________________________________________________________
+
+/// @struct CHART_WIDGET_t 
+/// @brief plots the history of a measurement, one column per bucket. 
+typedef struct chart_widget
+{
+    const MEASURE_WIDGET_t* source;     ///< Measurement plotted, gives the title, unit and scale. 
+    const HISTORY_METRIC_t  metric; 
+    const HISTORY_TIER_t    tier;       ///< Bucket period of a column. 
+    const char              period[WIDGET_STRING_LEN];  ///< Column period, shown under the plot. 
+}   CHART_WIDGET_t;
+
+
+/// @struct CHART_STATE_t 
+/// @brief what is plotted in a chart slot. 
+typedef struct chart_state
+{
+    uint32_t    sequence;   ///< History sequence of the last plotted bucket + 1. 
+    int32_t     min;        ///< Value at the bottom of the plot. 
+    int32_t     max;        ///< Value at the top of the plot. 
+}   CHART_STATE_t;
+
+
+// _ diagnostics widget ________________________________________________________
+
+typedef struct diag_counter
+{
+    const char*     label; 
+    const uint32_t* count; 
+}   DIAG_COUNTER_t;
+
+
+// _ menu widget _______________________________________________________________
+
+typedef struct menu_widget_state
+{
+    bool        is_valid;               ///< The menu has been drawn with this state. 
+    uint32_t    battery_percent; 
+    uint32_t    network_strength; 
+    bool        is_warn_triggered; 
+    bool        is_server_connected; 
+    bool        speaker_is_active; 
+}   MENU_WIDGET_STATE_t;
+
+
 // _ wrapper widget ____________________________________________________________
 
 typedef struct widget
@@ -123,24 +207,91 @@ typedef struct widget
     {
         const MEASURE_WIDGET_t*     measure_widget;
         const SETTING_WIDGET_t*    settings_widget; 
+        const CHART_WIDGET_t*      chart_widget; 
     };
 }   WIDGET_t;
 
 
+typedef union widget_value
+{
+    float           as_float; 
+    uint16_t        as_int; 
+    MEASUREMENT_t   as_fixed; 
+    CHART_STATE_t   as_chart; 
+    uint32_t        as_count;   ///< Sum of the diagnostics counters. 
+}   WIDGET_VALUE_t;
+
+
+/// @struct WIDGET_SLOT_t
+/// @brief screen location of a widget, remembers what was rendered there 
+///        during the last frame to only redraw it when it changes. 
+typedef struct widget_slot
+{
+    const uint32_t  x; 
+    const uint32_t  y; 
+    const WIDGET_t* widget;     ///< Widget rendered in the slot, NULL to force a redraw. 
+    WIDGET_VALUE_t  value;      ///< Value rendered by the widget, plot state of a chart. 
+}   WIDGET_SLOT_t;
+
+
 //* _ EXTERN VARIABLE DECLARATIONS _____________________________________________
 
 extern const MEASURE_WIDGET_t MEASURE_WIDGET_LUT[]; 
 extern const SETTING_WIDGET_t SETTINGS_WIDGET_LUT[]; 
+extern const CHART_WIDGET_t   CHART_WIDGET_LUT[]; 
 
 
 //* _ FUNCTION DECLARATIONS ____________________________________________________
 
+/// @fn void draw_menu_widget(uint32_t x, uint32_t y, uint32_t battery_percent); 
+/// @brief draws the menu, only if one of the displayed states changed since 
+///        the last call. 
 void draw_menu_widget(uint32_t x, uint32_t y, uint32_t battery_percent); 
 
 
+/// @fn void menu_widget_invalidate(void); 
+/// @brief forces the menu to be redrawn on the next call, use it after 
+///        clearing the screen. 
+void menu_widget_invalidate(void); 
+
+
 void draw_measurement_widget(uint32_t x, uint32_t y, const MEASURE_WIDGET_t* measure_widget); 
 
 
 void draw_settings_widget(uint32_t x, uint32_t y, const SETTING_WIDGET_t* widget);
 
+
+/// @fn void draw_chart_widget(uint32_t x, uint32_t y, const CHART_WIDGET_t* chart_widget, CHART_STATE_t* state); 
+/// @brief draws the whole chart, the axes are scaled to the plotted buckets. 
+/// @param state filled with what has been plotted. 
+void draw_chart_widget(uint32_t x, uint32_t y, const CHART_WIDGET_t* chart_widget, CHART_STATE_t* state); 
+
+
+/// @fn void update_chart_widget(uint32_t x, uint32_t y, const CHART_WIDGET_t* chart_widget, CHART_STATE_t* state); 
+/// @brief appends the buckets closed since the last call. The chart is fully 
+///        redrawn when a bucket is out of the axes or the sweep wraps around. 
+/// @param state what is plotted, updated. 
+void update_chart_widget(uint32_t x, uint32_t y, const CHART_WIDGET_t* chart_widget, CHART_STATE_t* state); 
+
+
+/// @fn void draw_diagnostics_widget(uint32_t x, uint32_t y); 
+/// @brief draws the detected SEN6x model and its error counters. 
+void draw_diagnostics_widget(uint32_t x, uint32_t y); 
+
+
+/// @fn bool widget_is_available(const WIDGET_t* widget); 
+/// @brief tells if the widget can be shown, a measurement or chart widget 
+///        needs its sensor to provide the measurement. 
+/// @param widget widget to check, can be NULL. 
+/// @return false if the widget is NULL or its measurement is not provided. 
+bool widget_is_available(const WIDGET_t* widget); 
+
+
+/// @fn void draw_widget_slot(WIDGET_SLOT_t* slot, const WIDGET_t* widget); 
+/// @brief clears and redraws the widget of a slot if it is not the one drawn 
+///        during the last frame or if its value changed. 
+/// @param slot   screen slot of the widget. 
+/// @param widget widget to draw in the slot, can be NULL. 
+void draw_widget_slot(WIDGET_SLOT_t* slot, const WIDGET_t* widget); 
+
 #endif
\ No newline at end of file
@@ -1,17 +1,97 @@
 #include "adc_processing.h"
 
 
-ADC_PROCESSED_DATA_t processed_data[ADC_CHANNEL_COUNT]; 
+MEASUREMENT_t processed_data[ADC_CHANNEL_COUNT] = {
+    #define X(channel, offset_uv, gain_ohm, sensitivity_pa, ticks_per_ppm, temp_bp, rh_bp, is_calibrated) \
+        [channel] = { .divider = ticks_per_ppm, .is_available = true, .is_nominal = !(is_calibrated) }, 
 
+        GAS_SENSORS
+    #undef X
+}; 
 
-void O2_sensor_process(void)
+
+static const GAS_SENSOR_t GAS_SENSOR_LUT[] = {
+    #define X(channel, offset_uv, gain_ohm, sensitivity_pa, ticks_per_ppm, temp_bp, rh_bp, is_calibrated) \
+        {channel, offset_uv, gain_ohm, sensitivity_pa, temp_bp, rh_bp}, 
+
+        GAS_SENSORS
+    #undef X
+}; 
+
+// Sequence number of the last ADC scan converted. 
+static uint32_t processed_sequence = 0; 
+
+
+/// @fn static int32_t GAS_sensor_convert(const GAS_SENSOR_t* sensor, uint16_t divider, int32_t temp_delta_cc, int32_t rh_delta_cp); 
+/// @brief concentration of one sensor in ticks of its measurement. 
+/// @param temp_delta_cc temperature from the reference point in 0.01 °C. 
+/// @param rh_delta_cp humidity from the reference point in 0.01 %RH. 
+static int32_t GAS_sensor_convert(const GAS_SENSOR_t* sensor, uint16_t divider, int32_t temp_delta_cc, int32_t rh_delta_cp); 
+
+/// @fn static int32_t GAS_reference_delta(const MEASUREMENT_t* measurement, int32_t reference); 
+/// @brief distance of a SEN6x measurement to the reference point in 0.01
+///        of its unit, 0 without a valid value so the sensitivity is not
+///        compensated. 
+static int32_t GAS_reference_delta(const MEASUREMENT_t* measurement, int32_t reference); 
+
+
+void GAS_sensors_process(void)
+{
+    MEASUREMENT_t*  measurement; 
+    int32_t         temp_delta_cc; 
+    int32_t         rh_delta_cp; 
+    uint32_t        i; 
+    
+    // The filtered data only changes at the end of a scan. 
+    if (ADC_scan_sequence == processed_sequence)
+        return; 
+    
+    processed_sequence = ADC_scan_sequence; 
+    
+    temp_delta_cc = GAS_reference_delta(&SEN6X_data.temp, GAS_REFERENCE_TEMP_CC); 
+    rh_delta_cp   = GAS_reference_delta(&SEN6X_data.humidity, GAS_REFERENCE_RH_CP); 
+    
+    for (i = 0; i < ARRAY_SIZE(GAS_SENSOR_LUT); i += 1)
+    {
+        measurement           = &processed_data[GAS_SENSOR_LUT[i].channel]; 
+        measurement->raw      = GAS_sensor_convert(&GAS_SENSOR_LUT[i], measurement->divider, temp_delta_cc, rh_delta_cp); 
+        measurement->is_valid = true; 
+    }
+    
+    return; 
+}
+
+
+static int32_t GAS_sensor_convert(const GAS_SENSOR_t* sensor, uint16_t divider, int32_t temp_delta_cc, int32_t rh_delta_cp)
 {
-    uint16_t    adc_conv; 
-    float       result; 
+    int64_t signal_uv; 
+    int64_t value; 
+    int32_t sensitivity_bp; 
+    
+    // Cell current from the amplifier output, then ticks from the current: 
+    // uV / (ohm * pA per ppm) is ppm / 10^6. 
+    signal_uv = ADC_GAS_TO_UV(ADC_data[sensor->channel].ema_filtered_data) - sensor->offset_uv; 
+    value     = signal_uv * 1000000 * divider / ((int64_t)sensor->gain_ohm * sensor->sensitivity_pa); 
     
-    adc_conv = ADC_data[ADC_O2].ema_filtered_data; 
+    // Sensitivity at the current conditions in 0.01 % of the reference one. 
+    sensitivity_bp = 10000 + (sensor->temp_coeff_bp * temp_delta_cc + sensor->rh_coeff_bp * rh_delta_cp) / 100; 
+    if (sensitivity_bp < GAS_SENSITIVITY_MIN_BP)
+        sensitivity_bp = GAS_SENSITIVITY_MIN_BP; 
     
-    result = ((((float)adc_conv * ADC_Q) - O2_OUTPUT_V_OFFSET) / - O2_R_GAIN) / O2_AMP_PER_PPM; 
+    value = value * 10000 / sensitivity_bp; 
+    
+    // The offset drifts around 0, a concentration is never negative. 
+    if (value < 0)
+        return 0; 
+    
+    return value > INT32_MAX ? INT32_MAX : (int32_t)value; 
+}
+
+
+static int32_t GAS_reference_delta(const MEASUREMENT_t* measurement, int32_t reference)
+{
+    if (!measurement->is_valid || measurement->divider == 0)
+        return 0; 
     
-    processed_data[ADC_O2].data = result; 
-}
\ No newline at end of file
+    return measurement->raw * 100 / measurement->divider - reference; 
+}
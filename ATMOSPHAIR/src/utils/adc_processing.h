@@ -4,32 +4,68 @@
 //* _ INCLUDES _________________________________________________________________
 
 #include <stdlib.h>
-#include "definitions.h" 
+#include "definitions.h"
 
 #include "../cores/adc.h"
+#include "../drivers/sen6x.h"
+#include "../utils/utils.h"
 
 
-#define ADC_Q               0.8e-3
+//* _ DEFINITIONS ______________________________________________________________
 
-// _ O2 SENSOR DEFINITIONS _____________________________________________________
+// ADC input scale, ADC_GAS_RESOLUTION bits over the 3.3 V reference. 
+#define ADC_REFERENCE_UV            3300000
+#define ADC_GAS_TO_UV(data)         (((int64_t)(data) * ADC_REFERENCE_UV) >> ADC_GAS_RESOLUTION)
 
-#define O2_R_GAIN           33000
-#define O2_AMP_PER_PPM      0.2e-9
-#define O2_OUTPUT_V_OFFSET  2
+// Reference point of the sensor sensitivities, and the lowest sensitivity
+// the compensation can give (in 0.01 %). 
+#define GAS_REFERENCE_TEMP_CC       2000        // 20 °C in 0.01 °C. 
+#define GAS_REFERENCE_RH_CP         5000        // 50 %RH in 0.01 %RH. 
+#define GAS_SENSITIVITY_MIN_BP      1000
 
+// _ GAS SENSOR DEFINITIONS ____________________________________________________
+
+// Electrochemical cells read through a transimpedance amplifier: the output
+// is offset_uv plus the cell current times gain_ohm, a negative gain inverts
+// the current. The sensitivity is the cell current per ppm at the reference
+// point, it drifts by temp_bp (0.01 % per °C) and rh_bp (0.01 % per %RH). 
+// Values are nominal, each unit is calibrated on its offset. Sensors without 
+// a calibration are converted with the datasheet values and flagged nominal, 
+// their readings are only indicative. 
+//                                    channel               offset_uv  gain_ohm  sens_pa  ticks_per_ppm  temp_bp  rh_bp  is_calibrated
+#define GAS_SENSORS                 X(ADC_H2S,              2000000,   33000,    700000,  10,            30,      0,     false)   \
+                                    X(ADC_O2,               2000000,   -33000,   200,     10,            20,      0,     true)    \
+                                    X(ADC_CO,               2000000,   33000,    70000,   10,            40,      5,     false)   \
+                                    X(ADC_FLAMMABLE_GASES,  2000000,   33000,    20000,   10,            25,      0,     false)
 
-typedef struct adc_processed_data
-{
-    float data; 
-}   ADC_PROCESSED_DATA_t;
 
+//* _ STRUCTURE DEFINITIONS ____________________________________________________
+
+/// @struct GAS_SENSOR_t
+/// @brief conversion of one analog channel to a gas concentration. 
+typedef struct gas_sensor
+{
+    ADC_CHANNEL_t   channel; 
+    int32_t         offset_uv;          ///< Amplifier output without gas. 
+    int32_t         gain_ohm;           ///< Transimpedance gain, signed. 
+    int32_t         sensitivity_pa;     ///< Cell current per ppm at the reference point. 
+    int32_t         temp_coeff_bp;      ///< Sensitivity drift in 0.01 % per °C. 
+    int32_t         rh_coeff_bp;        ///< Sensitivity drift in 0.01 % per %RH. 
+}   GAS_SENSOR_t; 
 
 
+//* _ EXTERN VARIABLE DECLARATIONS _____________________________________________
 
+/// @brief gas concentrations in ppm, indexed by ADC_CHANNEL_t. The 
+///        channels of GAS_SENSORS without a calibration are nominal. 
+extern MEASUREMENT_t processed_data[ADC_CHANNEL_COUNT]; 
 
-extern ADC_PROCESSED_DATA_t processed_data[ADC_CHANNEL_COUNT];
 
+//* _ FUNCTION DECLARATIONS ____________________________________________________
 
-void O2_sensor_process(void);
+/// @fn void GAS_sensors_process(void); 
+/// @brief converts the gas channels once per completed ADC scan, 
+///        compensated with the last SEN6x temperature and humidity. 
+void GAS_sensors_process(void); 
 
-#endif
\ No newline at end of file
+#endif
@@ -1,31 +1,240 @@
 #include "utils.h"
 
 
+//* _ STATIC VARIABLE DECLARATIONS _____________________________________________
+
+static const uint32_t POWERS_OF_10[FORMAT_MAX_DECIMALS + 1] = {
+    1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000, 
+}; 
+
+// CRC-8 of each byte value with a null register, polynomial CRC_8_POLYNOMIAL. 
+// The register of the next byte is CRC_8_LUT[crc ^ byte]. 
+static const uint8_t CRC_8_LUT[CRC_8_LUT_SIZE] = {
+    0x00, 0x31, 0x62, 0x53, 0xC4, 0xF5, 0xA6, 0x97, 0xB9, 0x88, 0xDB, 0xEA, 0x7D, 0x4C, 0x1F, 0x2E, 
+    0x43, 0x72, 0x21, 0x10, 0x87, 0xB6, 0xE5, 0xD4, 0xFA, 0xCB, 0x98, 0xA9, 0x3E, 0x0F, 0x5C, 0x6D, 
+    0x86, 0xB7, 0xE4, 0xD5, 0x42, 0x73, 0x20, 0x11, 0x3F, 0x0E, 0x5D, 0x6C, 0xFB, 0xCA, 0x99, 0xA8, 
+    0xC5, 0xF4, 0xA7, 0x96, 0x01, 0x30, 0x63, 0x52, 0x7C, 0x4D, 0x1E, 0x2F, 0xB8, 0x89, 0xDA, 0xEB, 
+    0x3D, 0x0C, 0x5F, 0x6E, 0xF9, 0xC8, 0x9B, 0xAA, 0x84, 0xB5, 0xE6, 0xD7, 0x40, 0x71, 0x22, 0x13, 
+    0x7E, 0x4F, 0x1C, 0x2D, 0xBA, 0x8B, 0xD8, 0xE9, 0xC7, 0xF6, 0xA5, 0x94, 0x03, 0x32, 0x61, 0x50, 
+    0xBB, 0x8A, 0xD9, 0xE8, 0x7F, 0x4E, 0x1D, 0x2C, 0x02, 0x33, 0x60, 0x51, 0xC6, 0xF7, 0xA4, 0x95, 
+    0xF8, 0xC9, 0x9A, 0xAB, 0x3C, 0x0D, 0x5E, 0x6F, 0x41, 0x70, 0x23, 0x12, 0x85, 0xB4, 0xE7, 0xD6, 
+    0x7A, 0x4B, 0x18, 0x29, 0xBE, 0x8F, 0xDC, 0xED, 0xC3, 0xF2, 0xA1, 0x90, 0x07, 0x36, 0x65, 0x54, 
+    0x39, 0x08, 0x5B, 0x6A, 0xFD, 0xCC, 0x9F, 0xAE, 0x80, 0xB1, 0xE2, 0xD3, 0x44, 0x75, 0x26, 0x17, 
+    0xFC, 0xCD, 0x9E, 0xAF, 0x38, 0x09, 0x5A, 0x6B, 0x45, 0x74, 0x27, 0x16, 0x81, 0xB0, 0xE3, 0xD2, 
+    0xBF, 0x8E, 0xDD, 0xEC, 0x7B, 0x4A, 0x19, 0x28, 0x06, 0x37, 0x64, 0x55, 0xC2, 0xF3, 0xA0, 0x91, 
+    0x47, 0x76, 0x25, 0x14, 0x83, 0xB2, 0xE1, 0xD0, 0xFE, 0xCF, 0x9C, 0xAD, 0x3A, 0x0B, 0x58, 0x69, 
+    0x04, 0x35, 0x66, 0x57, 0xC0, 0xF1, 0xA2, 0x93, 0xBD, 0x8C, 0xDF, 0xEE, 0x79, 0x48, 0x1B, 0x2A, 
+    0xC1, 0xF0, 0xA3, 0x92, 0x05, 0x34, 0x67, 0x56, 0x78, 0x49, 0x1A, 0x2B, 0xBC, 0x8D, 0xDE, 0xEF, 
+    0x82, 0xB3, 0xE0, 0xD1, 0x46, 0x77, 0x24, 0x15, 0x3B, 0x0A, 0x59, 0x68, 0xFF, 0xCE, 0x9D, 0xAC, 
+}; 
+
+
+//* _ STATIC FUNCTION DECLARATIONS _____________________________________________
+
+static uint32_t format_decimal(char* buffer, uint32_t size, bool is_negative, uint64_t integer, uint32_t fraction, uint32_t decimals); 
+static uint32_t format_string(char* buffer, uint32_t size, const char* str); 
+
+
 //* _ GENERAL UTILITY FUNCTIONS ________________________________________________
 
 uint8_t crc_8_check(const uint8_t* data, uint32_t length)
 {
-    uint8_t crc; 
-    int i; 
-    int j; 
+    uint8_t     crc; 
+    uint32_t    i; 
     
     crc = CRC_8_INIT_VAL; 
     
     // CRC-8-Dallas/Maxim check algorithm, see the page 57 of the SENSIRION 
-    // SEN6x sensor. 
+    // SEN6x sensor. The 8 shift/xor steps of each byte are precomputed. 
     for (i = 0; i < length; i += 1)
+        crc = CRC_8_LUT[crc ^ data[i]]; 
+    
+    return crc; 
+}
+
+
+uint32_t crc_8_bad_words(const uint8_t* data, uint32_t word_count)
+{
+    uint32_t    bad_words; 
+    uint32_t    i; 
+    uint8_t     crc; 
+    
+    // A frame too long for the bitmask can not be reported word by word, 
+    // every word is reported bad. 
+    if (word_count > CRC_8_MAX_WORDS)
+        return CRC_8_ALL_BAD; 
+    
+    // Each word is [MSB, LSB, CRC], the CRC is compared instead of being fed 
+    // to the register. 
+    bad_words = 0; 
+    for (i = 0; i < word_count; i += 1, data += CRC_8_WORD_LENGTH)
+    {
+        crc = CRC_8_LUT[CRC_8_LUT[CRC_8_INIT_VAL ^ data[0]] ^ data[1]]; 
+        if (crc != data[2])
+            bad_words |= 1UL << i; 
+    }
+    
+    return bad_words; 
+}
+
+
+//* _ STRING FORMATTING FUNCTIONS ______________________________________________
+
+uint32_t fixed_to_str(char* buffer, uint32_t size, int32_t value, uint32_t decimals)
+{
+    uint64_t magnitude; 
+    
+    magnitude = (value < 0) ? -(int64_t)value : value; 
+    
+    if (decimals > FORMAT_MAX_DECIMALS)
+        decimals = FORMAT_MAX_DECIMALS; 
+    
+    return format_decimal(
+        buffer, size, value < 0, 
+        magnitude / POWERS_OF_10[decimals], magnitude % POWERS_OF_10[decimals], 
+        decimals
+    ); 
+}
+
+
+uint32_t float_to_str(char* buffer, uint32_t size, float value, uint32_t decimals)
+{
+    uint32_t    bits; 
+    int32_t     exponent; 
+    uint64_t    scaled; 
+    uint64_t    remainder; 
+    uint64_t    half; 
+    bool        is_negative; 
+    
+    if (decimals > FORMAT_MAX_DECIMALS)
+        decimals = FORMAT_MAX_DECIMALS; 
+    
+    // Split the IEEE 754 single precision value, value = mantissa * 2^exponent. 
+    memcpy(&bits, &value, sizeof(bits)); 
+    is_negative = bits >> 31; 
+    exponent    = (bits >> 23) & 0xFF; 
+    scaled      = bits & 0x7FFFFF; 
+    
+    if (exponent == 0xFF)
+        return format_string(buffer, size, scaled ? "nan" : (is_negative ? "-inf" : "inf")); 
+    
+    // Normal numbers have an implicit leading one, subnormal numbers don't. 
+    if (exponent)
+        scaled |= 1UL << 23; 
+    else
+        exponent = 1; 
+    
+    exponent -= 127 + 23; 
+    
+    // Values without fractional part are written as an integer. 
+    if (exponent >= 0)
     {
-        crc ^= data[i]; 
+        if (exponent > 40)
+            return format_string(buffer, size, is_negative ? "-inf" : "inf"); 
         
-        for (j = 0; j < CRC_8_SIZE; j += 1)
-        {
-            if (crc & 0x80)
-                crc = (crc << 1) ^ CRC_8_POLYNOMIAL; 
-            
-            else
-                crc = (crc << 1);
-        }
+        return format_decimal(buffer, size, is_negative, scaled << exponent, 0, decimals); 
     }
     
-    return crc; 
-}
\ No newline at end of file
+    // The 24 bits mantissa times 10^9 fits in 54 bits, the scaled value is 
+    // exact before the shift. Shift out the fractional bits and round half to 
+    // even on what remains. 
+    scaled *= POWERS_OF_10[decimals]; 
+    
+    if (-exponent >= 64)
+        scaled = 0; 
+    
+    else
+    {
+        remainder = scaled & ((1ULL << -exponent) - 1); 
+        half      = 1ULL << (-exponent - 1); 
+        scaled  >>= -exponent; 
+        
+        if (remainder > half || (remainder == half && (scaled & 1)))
+            scaled += 1; 
+    }
+    
+    return format_decimal(
+        buffer, size, is_negative, 
+        scaled / POWERS_OF_10[decimals], scaled % POWERS_OF_10[decimals], 
+        decimals
+    ); 
+}
+
+
+uint32_t measurement_to_str(char* buffer, uint32_t size, const MEASUREMENT_t* measurement, uint32_t decimals)
+{
+    uint64_t magnitude; 
+    uint32_t divider; 
+    
+    if (decimals > FORMAT_MAX_DECIMALS)
+        decimals = FORMAT_MAX_DECIMALS; 
+    
+    divider   = measurement->divider ? measurement->divider : 1; 
+    magnitude = (measurement->raw < 0) ? -(int64_t)measurement->raw : measurement->raw; 
+    
+    // Rescale the ticks to the requested number of decimals. 
+    magnitude = (magnitude * POWERS_OF_10[decimals] + divider / 2) / divider; 
+    
+    return format_decimal(
+        buffer, size, measurement->raw < 0 && magnitude, 
+        magnitude / POWERS_OF_10[decimals], magnitude % POWERS_OF_10[decimals], 
+        decimals
+    ); 
+}
+
+
+//* _ STATIC FUNCTION IMPLEMENTATION ___________________________________________
+
+static uint32_t format_decimal(char* buffer, uint32_t size, bool is_negative, uint64_t integer, uint32_t fraction, uint32_t decimals)
+{
+    char        digits[FORMAT_BUFFER_SIZE]; 
+    uint32_t    len; 
+    uint32_t    i; 
+    
+    // Write the digits backward, decimals first. 
+    len = 0; 
+    for (i = 0; i < decimals; i += 1)
+    {
+        digits[len++] = '0' + fraction % 10; 
+        fraction /= 10; 
+    }
+    
+    if (decimals)
+        digits[len++] = '.'; 
+    
+    do
+    {
+        digits[len++] = '0' + integer % 10; 
+        integer /= 10; 
+    }   while (integer); 
+    
+    if (is_negative)
+        digits[len++] = '-'; 
+    
+    if (len >= size)
+        return format_string(buffer, size, ""); 
+    
+    for (i = 0; i < len; i += 1)
+        buffer[i] = digits[len - 1 - i]; 
+    
+    buffer[len] = '\0'; 
+    return len; 
+}
+
+
+static uint32_t format_string(char* buffer, uint32_t size, const char* str)
+{
+    uint32_t len; 
+    
+    len = strlen(str); 
+    if (!size)
+        return 0; 
+    
+    // Strings that don't fit are replaced by an empty string. 
+    if (len >= size)
+        len = 0; 
+    
+    memcpy(buffer, str, len); 
+    buffer[len] = '\0'; 
+    return len; 
+}
@@ -6,14 +6,39 @@
 #include <stdlib.h>
 #include "definitions.h" 
 
+#include <string.h>
+
 
 //* _ DEFINITIONS ______________________________________________________________
 
 #define CRC_8_POLYNOMIAL    0x31
 #define CRC_8_INIT_VAL      0xFF
-#define CRC_8_SIZE          8
+#define CRC_8_LUT_SIZE      256
+#define CRC_8_WORD_LENGTH   3           // MSB, LSB, CRC.
+#define CRC_8_MAX_WORDS     32          // Words checked by crc_8_bad_words.
+#define CRC_8_ALL_BAD       0xFFFFFFFFUL
 
 #define ARRAY_SIZE(arr)     (sizeof(arr) / sizeof((arr)[0]))
+#define ZIGZAG_ENCODE(x)    (((uint32_t)(x) << 1) ^ (uint32_t)((int32_t)(x) >> 31))
+#define ZIGZAG_DECODE(x)    ((int32_t)(((uint32_t)(x) >> 1) ^ -((uint32_t)(x) & 1)))
+
+#define FORMAT_MAX_DECIMALS 9
+#define FORMAT_BUFFER_SIZE  32
+
+
+//* _ STRUCTURE DEFINITIONS ____________________________________________________
+
+/// @struct MEASUREMENT_t
+/// @brief fixed-point measurement kept in the sensor native ticks, the real 
+///        value is raw / divider. 
+typedef struct measurement
+{
+    int32_t     raw;            ///< Value in sensor ticks. 
+    uint16_t    divider;        ///< Ticks per unit, scale descriptor of the field. 
+    bool        is_available;   ///< The sensor provides this measurement. 
+    bool        is_valid;       ///< The last sample carried a valid value, raw is kept from the previous one otherwise. 
+    bool        is_nominal;     ///< Converted with the nominal values of the sensor, the unit isn't calibrated. 
+}   MEASUREMENT_t;
 
 
 //* _ FUNCTION DECLARATIONS ____________________________________________________
@@ -28,4 +53,49 @@
 /// @return the CRC code calculated. 
 uint8_t crc_8_check(const uint8_t* data, uint32_t length); 
 
+
+/// @fn uint32_t crc_8_bad_words(const uint8_t* data, uint32_t word_count); 
+/// @brief checks a frame of [MSB, LSB, CRC] words in one pass. 
+/// @param data frame of words. 
+/// @param word_count number of words of the frame, at most CRC_8_MAX_WORDS. 
+/// @return a bitmask with the bit i set if the word i has a wrong CRC, 0 if 
+///         the whole frame is valid, CRC_8_ALL_BAD if the frame has more 
+///         than CRC_8_MAX_WORDS words. 
+uint32_t crc_8_bad_words(const uint8_t* data, uint32_t word_count); 
+
+
+/// @fn uint32_t fixed_to_str(char* buffer, uint32_t size, int32_t value, uint32_t decimals); 
+/// @brief writes a scaled integer as a decimal number, 1234 with 2 decimals 
+///        gives "12.34". 
+/// @param buffer   destination string, always null terminated. 
+/// @param size     size of the destination buffer. 
+/// @param value    scaled value. 
+/// @param decimals number of decimals of the scaled value (up to 
+///                 FORMAT_MAX_DECIMALS). 
+/// @return the length of the string, 0 if it doesn't fit in the buffer. 
+uint32_t fixed_to_str(char* buffer, uint32_t size, int32_t value, uint32_t decimals); 
+
+
+/// @fn uint32_t float_to_str(char* buffer, uint32_t size, float value, uint32_t decimals); 
+/// @brief writes a float with a fixed number of decimals using integer 
+///        arithmetic only. The output is the same as printf "%.*f" (rounded 
+///        half to even), values above 2^64 are written as "inf". 
+/// @param buffer   destination string, always null terminated. 
+/// @param size     size of the destination buffer. 
+/// @param value    value to write. 
+/// @param decimals number of decimals (up to FORMAT_MAX_DECIMALS). 
+/// @return the length of the string, 0 if it doesn't fit in the buffer. 
+uint32_t float_to_str(char* buffer, uint32_t size, float value, uint32_t decimals); 
+
+
+/// @fn uint32_t measurement_to_str(char* buffer, uint32_t size, const MEASUREMENT_t* measurement, uint32_t decimals); 
+/// @brief writes a fixed-point measurement in its real unit with a fixed 
+///        number of decimals, rounded half away from zero. 
+/// @param buffer      destination string, always null terminated. 
+/// @param size        size of the destination buffer. 
+/// @param measurement measurement to write. 
+/// @param decimals    number of decimals (up to FORMAT_MAX_DECIMALS). 
+/// @return the length of the string, 0 if it doesn't fit in the buffer. 
+uint32_t measurement_to_str(char* buffer, uint32_t size, const MEASUREMENT_t* measurement, uint32_t decimals); 
+
 #endif
\ No newline at end of file
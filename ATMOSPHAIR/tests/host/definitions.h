@@ -0,0 +1,129 @@
+#ifndef _HOST_DEFINITIONS_H_
+#define _HOST_DEFINITIONS_H_
+
+// Stand-in of the Harmony definitions.h for the host tests: only the standard
+// headers and the declarations the code under test needs. The peripherals are
+// emulated by the host/fake_*.c files. 
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+
+
+//* _ DMAC _____________________________________________________________________
+
+typedef enum
+{
+    DMAC_CHANNEL_0, 
+}   DMAC_CHANNEL; 
+
+typedef enum
+{
+    DMAC_TRANSFER_EVENT_NONE, 
+    DMAC_TRANSFER_EVENT_COMPLETE, 
+    DMAC_TRANSFER_EVENT_ERROR, 
+}   DMAC_TRANSFER_EVENT; 
+
+typedef void (*DMAC_CHANNEL_CALLBACK)(DMAC_TRANSFER_EVENT event, uintptr_t context); 
+
+void DMAC_ChannelCallbackRegister(DMAC_CHANNEL channel, DMAC_CHANNEL_CALLBACK callback, uintptr_t context); 
+bool DMAC_ChannelTransfer(DMAC_CHANNEL channel, const void* src, const void* dest, size_t size); 
+
+
+//* _ SERCOM2 SPI (DISPLAY) ____________________________________________________
+
+typedef struct
+{
+    struct
+    {
+        volatile uint32_t SERCOM_DATA; 
+        volatile uint8_t  SERCOM_INTFLAG; 
+    }   SPIM; 
+}   sercom_registers_t; 
+
+extern sercom_registers_t host_sercom2; 
+
+#define SERCOM2_REGS                    (&host_sercom2)
+#define SERCOM_SPIM_INTFLAG_TXC_Msk     0x02
+
+bool SERCOM2_SPI_Write(void* data, size_t size); 
+bool SERCOM2_SPI_IsBusy(void); 
+
+void DISPLAY_CS_Set(void); 
+void DISPLAY_CS_Clear(void); 
+void DISPLAY_DATA_Set(void); 
+void DISPLAY_DATA_Clear(void); 
+
+
+//* _ SERCOM1 I2C (SEN6X) ______________________________________________________
+
+typedef enum
+{
+    SERCOM_I2C_ERROR_NONE, 
+    SERCOM_I2C_ERROR_NAK, 
+    SERCOM_I2C_ERROR_BUS, 
+}   SERCOM_I2C_ERROR; 
+
+typedef void (*SERCOM_I2C_CALLBACK)(uintptr_t context); 
+
+void             SERCOM1_I2C_Initialize(void); 
+bool             SERCOM1_I2C_Read(uint16_t address, uint8_t* data, uint32_t size); 
+bool             SERCOM1_I2C_Write(uint16_t address, uint8_t* data, uint32_t size); 
+bool             SERCOM1_I2C_IsBusy(void); 
+SERCOM_I2C_ERROR SERCOM1_I2C_ErrorGet(void); 
+void             SERCOM1_I2C_CallbackRegister(SERCOM_I2C_CALLBACK callback, uintptr_t context); 
+void             SERCOM1_I2C_TransferAbort(void); 
+
+
+//* _ PORT (I2C BUS RECOVERY) __________________________________________________
+
+typedef enum
+{
+    PORT_PIN_PA08 = 8, 
+    PORT_PIN_PA09 = 9, 
+}   PORT_PIN; 
+
+#define PORT_PINCFG_PMUXEN_Msk  0x01
+#define PORT_PINCFG_INEN_Msk    0x02
+
+typedef struct
+{
+    uint8_t PORT_PINCFG[32]; 
+}   port_group_registers_t; 
+
+typedef struct
+{
+    port_group_registers_t GROUP[1]; 
+}   port_registers_t; 
+
+extern port_registers_t host_port; 
+#define PORT_REGS   (&host_port)
+
+void PORT_PinClear(PORT_PIN pin); 
+void PORT_PinInputEnable(PORT_PIN pin); 
+void PORT_PinOutputEnable(PORT_PIN pin); 
+bool PORT_PinRead(PORT_PIN pin); 
+
+
+//* _ ADC ______________________________________________________________________
+
+typedef enum
+{
+    ADC_POSINPUT_AIN0, 
+    ADC_POSINPUT_AIN1, 
+    ADC_POSINPUT_AIN2, 
+    ADC_POSINPUT_AIN3, 
+    ADC_POSINPUT_AIN4, 
+}   ADC_POSINPUT; 
+
+typedef enum
+{
+    ADC_NEGINPUT_AVSS = 0x18, 
+}   ADC_NEGINPUT; 
+
+typedef uint32_t ADC_STATUS; 
+typedef void (*ADC_CALLBACK)(ADC_STATUS status, uintptr_t context); 
+
+#endif
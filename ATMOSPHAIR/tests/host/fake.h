@@ -0,0 +1,67 @@
+#ifndef _HOST_FAKE_H_
+#define _HOST_FAKE_H_
+
+// Controls and state of the emulated peripherals of host/fake_*.c. 
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <time.h>
+
+//* _ SYSTICK __________________________________________________________________
+
+/// @brief simulated running time returned by SYSTICK_millis. 
+extern uint32_t host_millis; 
+
+
+//* _ DISPLAY __________________________________________________________________
+
+#define HOST_DISPLAY_COLUMNS    128
+#define HOST_DISPLAY_ROWS       64
+
+/// @brief RAM of the emulated SSD1362, two pixels per byte. 
+extern uint8_t  host_display_gddram[HOST_DISPLAY_ROWS][HOST_DISPLAY_COLUMNS]; 
+extern uint32_t host_display_data_bytes;      ///< GDDRAM bytes received. 
+extern uint32_t host_display_command_bytes;   ///< Command bytes received. 
+
+/// @brief runs the pending DMA transfers to the display and their completion 
+///        callbacks, including the transfers chained from the callbacks. 
+void host_dma_run(void); 
+
+
+//* _ I2C (SEN66) ______________________________________________________________
+
+// Words of the SEN66 READ_MEASURED frame. 
+#define HOST_SEN6X_WORDS        9
+
+/// @brief faults of a scenario segment, from its keyframe to the next one. 
+typedef enum
+{
+    HOST_FAULT_NONE, 
+    HOST_FAULT_NACK,        ///< Sensor unplugged, nothing is acknowledged. 
+    HOST_FAULT_CRC,         ///< Noisy bus, some answers have a corrupted word. 
+    HOST_FAULT_STUCK,       ///< The sensor holds SDA low until it is clocked out. 
+}   HOST_FAULT_t; 
+
+extern uint16_t host_sen6x_frame[HOST_SEN6X_WORDS];    ///< Last READ_MEASURED answer. 
+extern uint32_t host_i2c_transfers;                     ///< Transfers started on SERCOM1. 
+extern uint32_t host_i2c_bytes;                         ///< Address and data bytes on the bus. 
+extern uint32_t host_i2c_busy_us;                       ///< Time the bus was in use. 
+extern uint32_t host_i2c_recovery_clocks;               ///< SCL pulses given by the bus recovery. 
+
+/// @brief loads a CSV scenario of the SEN66 on SERCOM1, one keyframe per 
+///        line: time_s, PM1.0, PM2.5, PM4.0, PM10 (ug/m3), RH (%), 
+///        temperature (C), VOC and NOx index, CO2 (ppm) and the fault of the 
+///        segment (nack, crc, stuck or nothing). The values in between are 
+///        interpolated. 
+/// @return the duration of the scenario in seconds, 0 if it can't be read. 
+uint32_t host_sen6x_load(const char* path); 
+
+/// @brief fault of the scenario at host_millis. 
+HOST_FAULT_t host_sen6x_fault(void); 
+
+/// @brief ends the SERCOM1 transfers whose duration elapsed and calls their 
+///        callback, like the SERCOM interrupt. 
+void host_i2c_run(void); 
+
+#endif
@@ -0,0 +1,157 @@
+#include "definitions.h"
+#include "fake.h"
+
+// SERCOM2 and the DMAC channel feed an emulated SSD1362: the commands are 
+// decoded for the column and row windows, the data bytes are written to the 
+// GDDRAM with the same wrapping as the controller. 
+
+#define DISPLAY_CMD_MAX_SIZE    3
+
+sercom_registers_t host_sercom2 = { .SPIM = { .SERCOM_INTFLAG = SERCOM_SPIM_INTFLAG_TXC_Msk } }; 
+
+uint8_t  host_display_gddram[HOST_DISPLAY_ROWS][HOST_DISPLAY_COLUMNS]; 
+uint32_t host_display_data_bytes    = 0; 
+uint32_t host_display_command_bytes = 0; 
+
+static bool                  is_data = true; 
+static uint8_t               command[DISPLAY_CMD_MAX_SIZE]; 
+static uint32_t              command_size = 0; 
+static uint8_t               col_start = 0, col_end = HOST_DISPLAY_COLUMNS - 1, col = 0; 
+static uint8_t               row_start = 0, row_end = HOST_DISPLAY_ROWS - 1,    row = 0; 
+
+static DMAC_CHANNEL_CALLBACK dma_callback = NULL; 
+static const uint8_t*        dma_src      = NULL; 
+static size_t                dma_size     = 0; 
+
+
+/// @brief number of arguments of a controller command. 
+static uint32_t command_arg_count(uint8_t cmd)
+{
+    switch (cmd)
+    {
+        case 0x15: 
+        case 0x75: 
+            return 2; 
+        
+        case 0xA4: 
+        case 0xA5: 
+        case 0xA6: 
+        case 0xA7: 
+        case 0xAE: 
+        case 0xAF: 
+        case 0xB9: 
+            return 0; 
+        
+        default: 
+            return 1; 
+    }
+}
+
+
+static void display_command_byte(uint8_t byte)
+{
+    host_display_command_bytes += 1; 
+    command[command_size++] = byte; 
+    
+    if (command_size < 1 + command_arg_count(command[0]))
+        return; 
+    
+    if (command[0] == 0x15)
+    {
+        col_start = col = command[1]; 
+        col_end   = command[2]; 
+    }
+    
+    if (command[0] == 0x75)
+    {
+        row_start = row = command[1]; 
+        row_end   = command[2]; 
+    }
+    
+    command_size = 0; 
+    return; 
+}
+
+
+static void display_data_byte(uint8_t byte)
+{
+    host_display_data_bytes += 1; 
+    host_display_gddram[row][col] = byte; 
+    
+    if (++col <= col_end)
+        return; 
+    
+    col = col_start; 
+    if (++row > row_end)
+        row = row_start; 
+    
+    return; 
+}
+
+
+bool SERCOM2_SPI_Write(void* data, size_t size)
+{
+    size_t i; 
+    
+    for (i = 0; i < size; i += 1)
+    {
+        if (is_data)
+            display_data_byte(((uint8_t*)data)[i]); 
+        else
+            display_command_byte(((uint8_t*)data)[i]); 
+    }
+    
+    return true; 
+}
+
+
+bool SERCOM2_SPI_IsBusy(void)
+{
+    return false; 
+}
+
+
+void DISPLAY_CS_Set(void)     { return; }
+void DISPLAY_CS_Clear(void)   { return; }
+void DISPLAY_DATA_Set(void)   { is_data = true;  return; }
+void DISPLAY_DATA_Clear(void) { is_data = false; return; }
+
+
+void DMAC_ChannelCallbackRegister(DMAC_CHANNEL channel, DMAC_CHANNEL_CALLBACK callback, uintptr_t context)
+{
+    dma_callback = callback; 
+    return; 
+}
+
+
+bool DMAC_ChannelTransfer(DMAC_CHANNEL channel, const void* src, const void* dest, size_t size)
+{
+    // Only one transfer at a time, like the hardware channel. 
+    if (dma_src != NULL)
+        return false; 
+    
+    dma_src  = src; 
+    dma_size = size; 
+    return true; 
+}
+
+
+void host_dma_run(void)
+{
+    const uint8_t* src; 
+    size_t         i; 
+    
+    while (dma_src != NULL)
+    {
+        src     = dma_src; 
+        dma_src = NULL; 
+        
+        for (i = 0; i < dma_size; i += 1)
+            SERCOM2_SPI_Write((void*)&src[i], 1); 
+        
+        if (dma_callback != NULL)
+            dma_callback(DMAC_TRANSFER_EVENT_COMPLETE, 0); 
+    }
+    
+    return; 
+}
@@ -0,0 +1,433 @@
+#include <stdlib.h>
+#include <math.h>
+#include "definitions.h"
+#include "fake.h"
+#include "../../src/cores/systick.h"
+#include "../../src/utils/utils.h"
+
+// SERCOM1 and the bus recovery pins drive an emulated SEN66 playing a CSV 
+// scenario. The sensor decodes the commands of the driver, raises its data 
+// ready flag every second and answers with CRCs. A transfer lasts the time 
+// its bytes take at 100 kHz and ends from host_i2c_run. 
+
+#define SEN6X_ADDRESS           0x6B
+#define SAMPLE_PERIOD_MS        1000
+#define BYTE_US                 90          // 8 bits and the acknowledge at 100 kHz.
+#define MAX_KEYFRAMES           64
+#define MAX_ANSWER_WORDS        16
+#define CRC_FAULT_PERIOD        3           // Answers between two corruptions.
+#define STUCK_CLOCKS            5           // Bits left of the interrupted byte.
+
+#define PRODUCT_NAME            "SEN66"
+#define SERIAL_NUMBER           "HOST-SEN66"
+#define FRC_NO_CORRECTION       0x8000
+
+// Ticks of each READ_MEASURED word per unit of the CSV column. 
+static const double WORD_SCALES[HOST_SEN6X_WORDS] = {10, 10, 10, 10, 100, 200, 10, 10, 1}; 
+
+typedef struct
+{
+    uint32_t        time_s; 
+    int32_t         words[HOST_SEN6X_WORDS]; 
+    HOST_FAULT_t    fault; 
+}   KEYFRAME_t; 
+
+port_registers_t host_port; 
+uint16_t         host_sen6x_frame[HOST_SEN6X_WORDS]; 
+uint32_t         host_i2c_transfers       = 0; 
+uint32_t         host_i2c_bytes           = 0; 
+uint32_t         host_i2c_busy_us         = 0; 
+uint32_t         host_i2c_recovery_clocks = 0; 
+
+static KEYFRAME_t           keyframes[MAX_KEYFRAMES]; 
+static uint32_t             keyframe_count = 0; 
+
+// Transfer in progress. 
+static SERCOM_I2C_CALLBACK  callback         = NULL; 
+static uintptr_t            callback_context = 0; 
+static bool                 is_busy          = false; 
+static uint32_t             end_millis       = 0; 
+static SERCOM_I2C_ERROR     error            = SERCOM_I2C_ERROR_NONE; 
+
+// Bus lines, the sensor holds SDA low for the clocks left of its byte. 
+static bool                 is_sda_driven    = false; 
+static bool                 is_scl_driven    = false; 
+static uint32_t             sda_held_clocks  = 0; 
+static int32_t              stuck_keyframe   = -1; 
+
+// Sensor state. 
+static uint16_t             last_command     = 0; 
+static bool                 is_measuring     = false; 
+static uint32_t             ready_millis     = 0; 
+static uint32_t             answer_count     = 0; 
+
+
+//* _ SCENARIO _________________________________________________________________
+
+static HOST_FAULT_t parse_fault(const char* name)
+{
+    while (*name == ' ')
+        name += 1; 
+    
+    if (strncmp(name, "nack", 4) == 0)
+        return HOST_FAULT_NACK; 
+    
+    if (strncmp(name, "crc", 3) == 0)
+        return HOST_FAULT_CRC; 
+    
+    if (strncmp(name, "stuck", 5) == 0)
+        return HOST_FAULT_STUCK; 
+    
+    return HOST_FAULT_NONE; 
+}
+
+
+uint32_t host_sen6x_load(const char* path)
+{
+    FILE*       file; 
+    KEYFRAME_t* keyframe; 
+    char        line[256]; 
+    char*       cursor; 
+    uint32_t    i; 
+    
+    file = fopen(path, "r"); 
+    if (!file)
+        return 0; 
+    
+    // Comments and the header don't start with a digit. 
+    keyframe_count = 0; 
+    while (fgets(line, sizeof(line), file) && keyframe_count < MAX_KEYFRAMES)
+    {
+        if (line[0] < '0' || line[0] > '9')
+            continue; 
+        
+        keyframe         = &keyframes[keyframe_count]; 
+        keyframe->time_s = strtoul(line, &cursor, 10); 
+        for (i = 0; i < HOST_SEN6X_WORDS && *cursor == ','; i += 1)
+            keyframe->words[i] = lround(strtod(cursor + 1, &cursor) * WORD_SCALES[i]); 
+        
+        if (i < HOST_SEN6X_WORDS)
+            break; 
+        
+        keyframe->fault = *cursor == ',' ? parse_fault(cursor + 1) : HOST_FAULT_NONE; 
+        keyframe_count += 1; 
+    }
+    
+    fclose(file); 
+    if (keyframe_count < 2 || i < HOST_SEN6X_WORDS)
+        return 0; 
+    
+    return keyframes[keyframe_count - 1].time_s; 
+}
+
+
+/// @brief keyframe starting the segment of the current time. 
+static uint32_t current_keyframe(void)
+{
+    uint32_t i; 
+    
+    for (i = 1; i < keyframe_count; i += 1)
+    {
+        if (keyframes[i].time_s * 1000 > host_millis)
+            break; 
+    }
+    
+    return i - 1; 
+}
+
+
+HOST_FAULT_t host_sen6x_fault(void)
+{
+    return keyframe_count ? keyframes[current_keyframe()].fault : HOST_FAULT_NONE; 
+}
+
+
+/// @brief value of a word at the current time, the last keyframe holds. 
+static uint16_t interpolate(uint32_t word)
+{
+    const KEYFRAME_t* from; 
+    const KEYFRAME_t* to; 
+    uint32_t          i; 
+    
+    i    = current_keyframe(); 
+    from = &keyframes[i]; 
+    if (i + 1 >= keyframe_count)
+        return (uint16_t)from->words[word]; 
+    
+    to = &keyframes[i + 1]; 
+    return (uint16_t)(from->words[word] + (int64_t)(to->words[word] - from->words[word])
+        * (host_millis - from->time_s * 1000) / ((to->time_s - from->time_s) * 1000)); 
+}
+
+
+//* _ SENSOR ___________________________________________________________________
+
+static uint32_t str_to_words(uint16_t* words, const char* str, uint32_t word_count)
+{
+    uint32_t i; 
+    uint32_t length; 
+    
+    length = strlen(str); 
+    for (i = 0; i < word_count; i += 1)
+    {
+        words[i]  = (2 * i < length ? (uint8_t)str[2 * i] : 0) << 8; 
+        words[i] |= 2 * i + 1 < length ? (uint8_t)str[2 * i + 1] : 0; 
+    }
+    
+    return word_count; 
+}
+
+
+static void sensor_command(const uint8_t* data, uint32_t length)
+{
+    // Arguments of the write commands are ignored. 
+    last_command = data[0] << 8 | data[1]; 
+    switch (last_command)
+    {
+        case 0x0021:    // START_MEASUREMENT
+            is_measuring = true; 
+            ready_millis = host_millis + SAMPLE_PERIOD_MS; 
+            break; 
+        
+        case 0x0104:    // STOP_MEASUREMENT
+        case 0xD304:    // DEVICE_RESET
+            is_measuring = false; 
+            break; 
+        
+        case 0x5607:    // START_FAN_CLEANING
+        case 0x60B2:    // SET_TEMPERATURE_OFFSET
+        case 0x0202:    // GET_DATA_READY
+        case 0x0300:    // READ_MEASURED
+        case 0x0405:    // READ_RAW_VALUES
+        case 0x0316:    // READ_NUMBER_CONCENTRATION
+        case 0x6707:    // FORCED_CO2_RECALIBRATION
+        case 0xD014:    // GET_PRODUCT_NAME
+        case 0xD033:    // GET_SERIAL_NUMBER
+            break; 
+        
+        default: 
+            error = SERCOM_I2C_ERROR_NAK; 
+            break; 
+    }
+    
+    return; 
+}
+
+
+/// @return the number of words of the answer to the last command. 
+static uint32_t sensor_answer(uint16_t* words)
+{
+    uint32_t i; 
+    
+    switch (last_command)
+    {
+        case 0x0202:    // GET_DATA_READY
+            words[0] = is_measuring && (int32_t)(host_millis - ready_millis) >= 0; 
+            return 1; 
+        
+        case 0x0300:    // READ_MEASURED
+            if (!is_measuring)
+                return 0; 
+            
+            // Reading the frame clears the data ready flag, the samples 
+            // keep their own period. 
+            while ((int32_t)(host_millis - ready_millis) >= 0)
+                ready_millis += SAMPLE_PERIOD_MS; 
+            
+            for (i = 0; i < HOST_SEN6X_WORDS; i += 1)
+                words[i] = host_sen6x_frame[i] = interpolate(i); 
+            return HOST_SEN6X_WORDS; 
+        
+        case 0x6707:    // FORCED_CO2_RECALIBRATION
+            words[0] = FRC_NO_CORRECTION; 
+            return 1; 
+        
+        case 0xD014:    // GET_PRODUCT_NAME
+            return str_to_words(words, PRODUCT_NAME, MAX_ANSWER_WORDS); 
+        
+        case 0xD033:    // GET_SERIAL_NUMBER
+            return str_to_words(words, SERIAL_NUMBER, MAX_ANSWER_WORDS); 
+        
+        // Raw values and number concentrations are not emulated. 
+        default: 
+            return 0; 
+    }
+}
+
+
+//* _ SERCOM1 __________________________________________________________________
+
+/// @brief starts a transfer of length bytes and applies the fault of the 
+///        scenario. 
+/// @return false if a transfer is already in progress. 
+static bool transfer_begin(uint16_t address, uint32_t length)
+{
+    uint32_t keyframe; 
+    
+    if (is_busy)
+        return false; 
+    
+    keyframe            = current_keyframe(); 
+    is_busy             = true; 
+    error               = SERCOM_I2C_ERROR_NONE; 
+    end_millis          = host_millis + ((length + 1) * BYTE_US + 999) / 1000; 
+    host_i2c_transfers += 1; 
+    host_i2c_bytes     += length + 1; 
+    host_i2c_busy_us   += (length + 1) * BYTE_US; 
+    
+    // The sensor gets stuck once at the start of its segment. 
+    if (keyframes[keyframe].fault == HOST_FAULT_STUCK && stuck_keyframe != (int32_t)keyframe)
+    {
+        stuck_keyframe  = keyframe; 
+        sda_held_clocks = STUCK_CLOCKS; 
+    }
+    
+    if (keyframes[keyframe].fault == HOST_FAULT_NACK)
+        is_measuring = false; 
+    
+    if (address != SEN6X_ADDRESS || keyframes[keyframe].fault == HOST_FAULT_NACK)
+        error = SERCOM_I2C_ERROR_NAK; 
+    
+    return true; 
+}
+
+
+void SERCOM1_I2C_Initialize(void)
+{
+    is_busy = false; 
+    error   = SERCOM_I2C_ERROR_NONE; 
+    return; 
+}
+
+
+bool SERCOM1_I2C_Write(uint16_t address, uint8_t* data, uint32_t size)
+{
+    if (!transfer_begin(address, size))
+        return false; 
+    
+    if (error == SERCOM_I2C_ERROR_NONE && size >= 2)
+        sensor_command(data, size); 
+    
+    return true; 
+}
+
+
+bool SERCOM1_I2C_Read(uint16_t address, uint8_t* data, uint32_t size)
+{
+    uint16_t words[MAX_ANSWER_WORDS]; 
+    uint32_t word_count; 
+    uint32_t i; 
+    
+    if (!transfer_begin(address, size))
+        return false; 
+    
+    if (error != SERCOM_I2C_ERROR_NONE)
+        return true; 
+    
+    // Words not part of the answer are read as 0xFFFF. 
+    word_count = sensor_answer(words); 
+    for (i = 0; i < size / 3; i += 1)
+    {
+        data[i * 3]     = i < word_count ? words[i] >> 8 : 0xFF; 
+        data[i * 3 + 1] = i < word_count ? words[i] & 0xFF : 0xFF; 
+        data[i * 3 + 2] = crc_8_check(&data[i * 3], 2); 
+    }
+    
+    answer_count += 1; 
+    if (host_sen6x_fault() == HOST_FAULT_CRC && answer_count % CRC_FAULT_PERIOD == 0 && size >= 3)
+        data[(answer_count / CRC_FAULT_PERIOD) % (size / 3) * 3 + 2] ^= 0x5A; 
+    
+    return true; 
+}
+
+
+bool SERCOM1_I2C_IsBusy(void)
+{
+    return is_busy; 
+}
+
+
+SERCOM_I2C_ERROR SERCOM1_I2C_ErrorGet(void)
+{
+    return error; 
+}
+
+
+void SERCOM1_I2C_CallbackRegister(SERCOM_I2C_CALLBACK new_callback, uintptr_t context)
+{
+    callback         = new_callback; 
+    callback_context = context; 
+    return; 
+}
+
+
+void SERCOM1_I2C_TransferAbort(void)
+{
+    is_busy = false; 
+    return; 
+}
+
+
+void host_i2c_run(void)
+{
+    // A transfer never ends while SDA is held low. 
+    if (!is_busy || sda_held_clocks > 0 || (int32_t)(host_millis - end_millis) < 0)
+        return; 
+    
+    // The callback can start the next transfer. 
+    is_busy = false; 
+    if (callback)
+        callback(callback_context); 
+    
+    return; 
+}
+
+
+//* _ PORT _____________________________________________________________________
+
+void PORT_PinClear(PORT_PIN pin)
+{
+    return; 
+}
+
+
+void PORT_PinOutputEnable(PORT_PIN pin)
+{
+    // The output latch is low, an enabled output pulls the line down. 
+    if (pin == PORT_PIN_PA08)
+        is_sda_driven = true; 
+    
+    else
+        is_scl_driven = true; 
+    
+    return; 
+}
+
+
+void PORT_PinInputEnable(PORT_PIN pin)
+{
+    // SCL released by the pull-up, the sensor shifts out the next bit. 
+    if (pin == PORT_PIN_PA09 && is_scl_driven)
+    {
+        host_i2c_recovery_clocks += 1; 
+        if (sda_held_clocks > 0)
+            sda_held_clocks -= 1; 
+    }
+    
+    if (pin == PORT_PIN_PA08)
+        is_sda_driven = false; 
+    
+    else
+        is_scl_driven = false; 
+    
+    return; 
+}
+
+
+bool PORT_PinRead(PORT_PIN pin)
+{
+    if (pin == PORT_PIN_PA08)
+        return !is_sda_driven && sda_held_clocks == 0; 
+    
+    return !is_scl_driven; 
+}
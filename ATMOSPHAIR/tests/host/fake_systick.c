@@ -0,0 +1,28 @@
+#include "../../src/cores/systick.h"
+#include "fake.h"
+
+// The milliseconds are simulated, the tests move them forward. The 
+// microseconds come from the host clock so render times are real. 
+
+uint32_t host_millis = 0; 
+
+
+void SYSTICK_init(void)
+{
+    return; 
+}
+
+
+uint32_t SYSTICK_millis(void)
+{
+    return host_millis; 
+}
+
+
+uint32_t SYSTICK_micros(void)
+{
+    struct timespec now; 
+    
+    clock_gettime(CLOCK_MONOTONIC, &now); 
+    return (uint32_t)(now.tv_sec * 1000000u + now.tv_nsec / 1000); 
+}
@@ -0,0 +1,61 @@
+#ifndef _HOST_TEST_H_
+#define _HOST_TEST_H_
+
+// Minimal test helpers shared by the host tests. 
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+/// @brief counts and prints a failed check, the test goes on. 
+#define CHECK(cond, ...)    do {                                                \
+                                if (!(cond))                                    \
+                                {                                               \
+                                    printf("FAIL %s:%d: ", __FILE__, __LINE__); \
+                                    printf(__VA_ARGS__);                        \
+                                    printf("\n");                               \
+                                    test_failures += 1;                         \
+                                }                                               \
+                            } while (0)
+
+static unsigned long test_failures = 0; 
+static uint32_t      test_seed     = 0x12345678; 
+
+
+/// @brief the test is run by "make bench". 
+static inline bool test_is_bench(int argc, char** argv)
+{
+    return argc > 1 && strcmp(argv[1], "--bench") == 0; 
+}
+
+
+/// @brief xorshift32, the tests are reproducible. 
+static inline uint32_t test_random(void)
+{
+    test_seed ^= test_seed << 13; 
+    test_seed ^= test_seed >> 17; 
+    test_seed ^= test_seed << 5; 
+    return test_seed; 
+}
+
+
+static inline uint64_t test_now_ns(void)
+{
+    struct timespec now; 
+    
+    clock_gettime(CLOCK_MONOTONIC, &now); 
+    return (uint64_t)now.tv_sec * 1000000000u + now.tv_nsec; 
+}
+
+
+/// @brief prints the result of the test. 
+/// @return the exit code of the test. 
+static inline int test_report(const char* name)
+{
+    printf("%s: %s (%lu failed checks)\n", name, test_failures ? "FAIL" : "PASS", test_failures); 
+    return test_failures ? 1 : 0; 
+}
+
+#endif
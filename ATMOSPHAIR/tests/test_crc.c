@@ -0,0 +1,174 @@
+// Equivalence test of the table driven CRC-8 against the bitwise algorithm 
+// of the SEN6x datasheet, exhaustive over every 1 and 2 byte input, and 
+// benchmark of both. 
+
+#include "test.h"
+#include "utils/utils.h"
+
+#define FUZZ_BUFFER_COUNT   200000
+#define FUZZ_FRAME_COUNT    200000
+#define BENCH_COUNT         200000
+
+
+/// @brief CRC-8 computed bit by bit, as given by the datasheet. 
+static uint8_t crc_8_bitwise(const uint8_t* data, uint32_t length)
+{
+    uint8_t  crc = CRC_8_INIT_VAL; 
+    uint32_t i; 
+    int      bit; 
+    
+    for (i = 0; i < length; i += 1)
+    {
+        crc ^= data[i]; 
+        for (bit = 0; bit < 8; bit += 1)
+            crc = (crc & 0x80) ? (uint8_t)((crc << 1) ^ CRC_8_POLYNOMIAL) : (uint8_t)(crc << 1); 
+    }
+    
+    return crc; 
+}
+
+
+static void test_exhaustive(void)
+{
+    uint8_t  word[CRC_8_WORD_LENGTH]; 
+    uint32_t value; 
+    uint32_t crc; 
+    uint32_t expected; 
+    
+    for (value = 0; value < 0x100; value += 1)
+    {
+        word[0] = value; 
+        CHECK(crc_8_check(word, 1) == crc_8_bitwise(word, 1), "byte 0x%02X", value); 
+    }
+    
+    // Every word with each of the 256 CRC values, only the right one passes. 
+    for (value = 0; value < 0x10000; value += 1)
+    {
+        word[0]  = value >> 8; 
+        word[1]  = value & 0xFF; 
+        expected = crc_8_bitwise(word, 2); 
+        CHECK(crc_8_check(word, 2) == expected, "word 0x%04X", value); 
+        
+        for (crc = 0; crc < 0x100; crc += 1)
+        {
+            word[2] = crc; 
+            CHECK(crc_8_bad_words(word, 1) == (crc == expected ? 0 : 1), 
+                  "word 0x%04X with CRC 0x%02X", value, crc); 
+        }
+        
+        word[2] = expected; 
+        CHECK(crc_8_check(word, 3) == 0, "word 0x%04X with its CRC", value); 
+    }
+}
+
+
+/// @brief random buffers of every length up to a full frame. 
+static void test_buffers(void)
+{
+    uint8_t  buffer[CRC_8_MAX_WORDS * CRC_8_WORD_LENGTH]; 
+    uint32_t length; 
+    uint32_t i; 
+    long     n; 
+    
+    for (n = 0; n < FUZZ_BUFFER_COUNT; n += 1)
+    {
+        length = test_random() % (sizeof(buffer) + 1); 
+        for (i = 0; i < length; i += 1)
+            buffer[i] = test_random(); 
+        
+        CHECK(crc_8_check(buffer, length) == crc_8_bitwise(buffer, length), "length %u", length); 
+    }
+}
+
+
+/// @brief frames with random corrupted words, the mask gives each of them. 
+static void test_frames(void)
+{
+    uint8_t  frame[(CRC_8_MAX_WORDS + 1) * CRC_8_WORD_LENGTH]; 
+    uint8_t* word; 
+    uint32_t word_count; 
+    uint32_t corrupted; 
+    uint32_t result; 
+    uint32_t i; 
+    long     n; 
+    
+    for (n = 0; n < FUZZ_FRAME_COUNT; n += 1)
+    {
+        word_count = 1 + test_random() % CRC_8_MAX_WORDS; 
+        corrupted  = (test_random() % 4 == 0) ? 0 : test_random(); 
+        for (i = 0; i < word_count; i += 1)
+        {
+            word    = &frame[i * CRC_8_WORD_LENGTH]; 
+            word[0] = test_random(); 
+            word[1] = test_random(); 
+            word[2] = crc_8_bitwise(word, 2); 
+            if (corrupted & (1UL << i))
+                word[test_random() % CRC_8_WORD_LENGTH] ^= 1 + test_random() % 0xFF; 
+        }
+        
+        if (word_count < 32)
+            corrupted &= (1UL << word_count) - 1; 
+        
+        result = crc_8_bad_words(frame, word_count); 
+        CHECK(result == corrupted, "%u words: 0x%08X instead of 0x%08X", word_count, result, corrupted); 
+    }
+    
+    // Too long for the mask: nothing is reported valid. 
+    for (i = 0; i <= CRC_8_MAX_WORDS; i += 1)
+    {
+        word    = &frame[i * CRC_8_WORD_LENGTH]; 
+        word[2] = crc_8_bitwise(word, 2); 
+    }
+    
+    CHECK(crc_8_bad_words(frame, CRC_8_MAX_WORDS) == 0, "valid frame of %d words", CRC_8_MAX_WORDS); 
+    CHECK(crc_8_bad_words(frame, CRC_8_MAX_WORDS + 1) == CRC_8_ALL_BAD, "frame of %d words", CRC_8_MAX_WORDS + 1); 
+}
+
+
+/// @brief one frame of the largest SEN6x measurement checked word by word 
+///        with the bitwise CRC, as before the table, then with the table. 
+static void bench(void)
+{
+    uint8_t           frame[CRC_8_MAX_WORDS * CRC_8_WORD_LENGTH]; 
+    volatile uint32_t sink = 0; 
+    uint64_t          start; 
+    uint64_t          bitwise_ns; 
+    uint64_t          table_ns; 
+    uint32_t          i; 
+    long              n; 
+    
+    for (i = 0; i < CRC_8_MAX_WORDS; i += 1)
+    {
+        frame[i * CRC_8_WORD_LENGTH]     = test_random(); 
+        frame[i * CRC_8_WORD_LENGTH + 1] = test_random(); 
+        frame[i * CRC_8_WORD_LENGTH + 2] = crc_8_bitwise(&frame[i * CRC_8_WORD_LENGTH], 2); 
+    }
+    
+    start = test_now_ns(); 
+    for (n = 0; n < BENCH_COUNT; n += 1)
+        for (i = 0; i < CRC_8_MAX_WORDS; i += 1)
+            sink += crc_8_bitwise(&frame[i * CRC_8_WORD_LENGTH], 2) != frame[i * CRC_8_WORD_LENGTH + 2]; 
+    bitwise_ns = test_now_ns() - start; 
+    
+    start = test_now_ns(); 
+    for (n = 0; n < BENCH_COUNT; n += 1)
+        sink += crc_8_bad_words(frame, CRC_8_MAX_WORDS); 
+    table_ns = test_now_ns() - start; 
+    
+    printf("  %d words: bitwise %.1f ns, table %.1f ns, x%.1f\n", CRC_8_MAX_WORDS, 
+           (double)bitwise_ns / BENCH_COUNT, (double)table_ns / BENCH_COUNT, 
+           (double)bitwise_ns / table_ns); 
+}
+
+
+int main(int argc, char** argv)
+{
+    test_exhaustive(); 
+    test_buffers(); 
+    test_frames(); 
+    
+    if (test_is_bench(argc, argv))
+        bench(); 
+    
+    return test_report("crc"); 
+}
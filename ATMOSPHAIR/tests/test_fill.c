@@ -0,0 +1,111 @@
+// Span fill of the framebuffer against the per-pixel fill it replaced: same
+// pixels and same dirty area for random rectangles, and benchmark of the 
+// time per filled pixel of both. 
+//
+// The driver is included to reach the framebuffer. 
+
+#include "test.h"
+#include "drivers/ssd1362.c"
+
+#define FUZZ_COUNT      200000
+#define BENCH_PIXELS    200000000
+
+
+/// @brief per-pixel fill, the implementation before the span fill. 
+static void pixel_fill(uint32_t x, uint32_t y, uint32_t w, uint32_t h, uint8_t intensity)
+{
+    uint32_t i; 
+    uint32_t j; 
+    
+    for (j = 0; j < h; j += 1)
+        for (i = 0; i < w; i += 1)
+            display_set_pixel(x + i, y + j, intensity); 
+    
+    return; 
+}
+
+
+static void fuzz_fill_span(void)
+{
+    static PIXEL_INTENSITY_t    expected[BUFFER_SIZE]; 
+    DIRTY_AREA_t                expected_area; 
+    uint32_t                    x, y, w, h; 
+    uint8_t                     intensity; 
+    long                        i; 
+    
+    for (i = 0; i < FUZZ_COUNT; i += 1)
+    {
+        // Some rectangles go past the screen edges. 
+        x         = test_random() % (DISPLAY_WIDTH + 8); 
+        y         = test_random() % (DISPLAY_HEIGHT + 4); 
+        w         = test_random() % (DISPLAY_WIDTH + 8); 
+        h         = test_random() % 16; 
+        intensity = test_random() & 0x0F; 
+        
+        dirty_area.is_dirty = false; 
+        pixel_fill(x, y, w, h, intensity); 
+        memcpy(expected, framebuffer, sizeof(expected)); 
+        expected_area = dirty_area; 
+        
+        // Undo the fill with random content so a missed pixel shows. 
+        pixel_fill(x, y, w, h, intensity ^ (1 + test_random() % 15)); 
+        dirty_area.is_dirty = false; 
+        display_draw_fillrect(x, y, w, h, intensity); 
+        
+        CHECK(memcmp(expected, framebuffer, sizeof(expected)) == 0, 
+              "fillrect(%u, %u, %u, %u) pixels differ", x, y, w, h); 
+        CHECK(expected_area.is_dirty == dirty_area.is_dirty 
+              && (!dirty_area.is_dirty || memcmp(&expected_area, &dirty_area, sizeof(dirty_area)) == 0), 
+              "fillrect(%u, %u, %u, %u) dirty area differs", x, y, w, h); 
+        
+        if (test_failures > 10)
+            return; 
+    }
+}
+
+
+/// @brief time per filled pixel of both fills for one rectangle shape. 
+static void bench_shape(const char* name, uint32_t x, uint32_t y, uint32_t w, uint32_t h)
+{
+    uint64_t start; 
+    uint64_t pixel_ns; 
+    uint64_t span_ns; 
+    long     count = BENCH_PIXELS / (w * h); 
+    long     i; 
+    
+    start = test_now_ns(); 
+    for (i = 0; i < count / 16; i += 1)
+        pixel_fill(x, y, w, h, i & 0x0F); 
+    pixel_ns = (test_now_ns() - start) * 16; 
+    
+    start = test_now_ns(); 
+    for (i = 0; i < count; i += 1)
+        display_draw_fillrect(x, y, w, h, i & 0x0F); 
+    span_ns = test_now_ns() - start; 
+    
+    printf("  %-24s per pixel %6.3f ns/pixel, span %6.3f ns/pixel (x%.0f)\n", name, 
+           (double)pixel_ns / count / (w * h), (double)span_ns / count / (w * h), 
+           (double)pixel_ns / span_ns); 
+}
+
+
+static void bench(void)
+{
+    bench_shape("full screen", 0, 0, DISPLAY_WIDTH, DISPLAY_HEIGHT); 
+    bench_shape("value box 50x16, odd x", 9, 34, 50, 16); 
+    bench_shape("h line 200 px", 3, 11, 200, 1); 
+    bench_shape("v line 48 px", 7, 14, 1, 48); 
+}
+
+
+int main(int argc, char** argv)
+{
+    if (test_is_bench(argc, argv))
+    {
+        bench(); 
+        return 0; 
+    }
+    
+    fuzz_fill_span(); 
+    return test_report("fill"); 
+}
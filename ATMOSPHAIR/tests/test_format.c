@@ -0,0 +1,148 @@
+// Fuzz test of the fixed-point formatters against the libc printf, and 
+// benchmark of both. 
+
+#include <math.h>
+#include "test.h"
+#include "utils/utils.h"
+
+#define FUZZ_FLOAT_COUNT    2000000
+#define FUZZ_FIXED_COUNT    1000000
+#define BENCH_COUNT         2000000
+
+
+/// @brief random float: any bit pattern, a ratio of integers or a value 
+///        near a rounding tie of 2 decimals. 
+static float random_float(void)
+{
+    uint32_t bits; 
+    float    value; 
+    
+    switch (test_random() % 3)
+    {
+        case 0: 
+            bits = test_random(); 
+            memcpy(&value, &bits, sizeof(value)); 
+            return value; 
+    
+        case 1: 
+            return (float)((int32_t)(test_random() % 2000000) - 1000000) / (1 + test_random() % 1000); 
+    
+        default: 
+            return (test_random() % 100000) / 100.0f + ((int32_t)(test_random() % 3) - 1) * 0.005f; 
+    }
+}
+
+
+static void fuzz_float_to_str(void)
+{
+    char     expected[64]; 
+    char     result[64]; 
+    uint32_t length; 
+    uint32_t decimals; 
+    float    value; 
+    long     i; 
+    
+    for (i = 0; i < FUZZ_FLOAT_COUNT; i += 1)
+    {
+        value    = random_float(); 
+        decimals = test_random() % 5; 
+    
+        // NaN is not formatted, values above 2^64 are written as "inf". 
+        if (isnan(value) || (fabsf(value) >= 1.8e19f && !isinf(value)))
+            continue; 
+    
+        snprintf(expected, sizeof(expected), "%.*f", (int)decimals, value); 
+        length = float_to_str(result, sizeof(result), value, decimals); 
+        CHECK(strcmp(expected, result) == 0 && length == strlen(expected), 
+              "float_to_str(%a, %u) gives \"%s\" instead of \"%s\"", value, decimals, result, expected); 
+    }
+}
+
+
+static void fuzz_fixed_to_str(void)
+{
+    char      expected[64]; 
+    char      result[64]; 
+    int32_t   value; 
+    uint32_t  decimals; 
+    long long power; 
+    long long magnitude; 
+    uint32_t  i; 
+    long      n; 
+    
+    for (n = 0; n < FUZZ_FIXED_COUNT; n += 1)
+    {
+        value    = (int32_t)test_random(); 
+        decimals = test_random() % 6; 
+    
+        for (power = 1, i = 0; i < decimals; i += 1)
+            power *= 10; 
+    
+        magnitude = llabs((long long)value); 
+        if (decimals)
+            snprintf(expected, sizeof(expected), "%s%lld.%0*lld", value < 0 ? "-" : "", magnitude / power, (int)decimals, magnitude % power); 
+        else
+            snprintf(expected, sizeof(expected), "%d", value); 
+    
+        fixed_to_str(result, sizeof(result), value, decimals); 
+        CHECK(strcmp(expected, result) == 0, "fixed_to_str(%d, %u) gives \"%s\" instead of \"%s\"", value, decimals, result, expected); 
+    }
+}
+
+
+static void check_edge_cases(void)
+{
+    char result[8]; 
+    
+    // Too small a buffer gives an empty string and a length of 0. 
+    CHECK(float_to_str(result, 4, 123.45f, 2) == 0 && result[0] == '\0', "truncated float gives \"%s\"", result); 
+    CHECK(fixed_to_str(result, 4, 12345, 2) == 0 && result[0] == '\0', "truncated fixed gives \"%s\"", result); 
+    
+    float_to_str(result, sizeof(result), -0.0f, 2); 
+    CHECK(strcmp(result, "-0.00") == 0, "-0.0 gives \"%s\"", result); 
+    
+    float_to_str(result, sizeof(result), INFINITY, 2); 
+    CHECK(strcmp(result, "inf") == 0, "infinity gives \"%s\"", result); 
+}
+
+
+static void bench(void)
+{
+    char     buffer[64]; 
+    float    values[1024]; 
+    uint64_t start; 
+    uint64_t printf_ns; 
+    uint64_t format_ns; 
+    long     i; 
+    
+    for (i = 0; i < 1024; i += 1)
+        values[i] = (test_random() % 1000000) / 100.0f; 
+    
+    start = test_now_ns(); 
+    for (i = 0; i < BENCH_COUNT; i += 1)
+        snprintf(buffer, sizeof(buffer), "%.2f", values[i & 1023]); 
+    printf_ns = test_now_ns() - start; 
+    
+    start = test_now_ns(); 
+    for (i = 0; i < BENCH_COUNT; i += 1)
+        float_to_str(buffer, sizeof(buffer), values[i & 1023], 2); 
+    format_ns = test_now_ns() - start; 
+    
+    printf("snprintf \"%%.2f\": %.1f ns/call, float_to_str: %.1f ns/call\n", 
+           (double)printf_ns / BENCH_COUNT, (double)format_ns / BENCH_COUNT); 
+}
+
+
+int main(int argc, char** argv)
+{
+    if (test_is_bench(argc, argv))
+    {
+        bench(); 
+        return 0; 
+    }
+    
+    fuzz_float_to_str(); 
+    fuzz_fixed_to_str(); 
+    check_edge_cases(); 
+    return test_report("format"); 
+}
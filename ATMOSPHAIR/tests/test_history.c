@@ -0,0 +1,270 @@
+// Measurement history: the min, max and mean of every bucket of every tier
+// are checked against an exact aggregation of the same samples over 8 days 
+// of signals of different shapes. The RAM footprint and the time kept by each 
+// tier are reported. 
+//
+// The history is included to reach its rings. 
+
+#include <math.h>
+#include "test.h"
+#include "fake.h"
+#include "processes/history.c"
+
+#define SIM_SECONDS         (8 * 24 * 3600)
+#define CHECK_PERIOD_S      (6 * 3600)
+#define REF_BUCKETS         1024
+#define RAW_BUCKET_SIZE     (3 * sizeof(int32_t))
+
+
+//* _ SCENE ____________________________________________________________________
+
+SEN6X_DATA_t            SEN6X_data; 
+volatile ADC_RAW_DATA_t ADC_data[ADC_CHANNEL_COUNT]; 
+
+
+//* _ REFERENCE ________________________________________________________________
+
+// Exact aggregation of the samples, last REF_BUCKETS buckets of each tier. 
+typedef struct
+{
+    HISTORY_ACC_t   open; 
+    HISTORY_ACC_t   closed[REF_BUCKETS]; 
+    uint32_t        count; 
+}   REF_TIER_t; 
+
+static REF_TIER_t reference[HISTORY_METRIC_COUNT][HISTORY_TIER_COUNT]; 
+
+static const uint32_t TIER_SECONDS[HISTORY_TIER_COUNT] = {
+    1, HISTORY_TIER_1_RATIO, HISTORY_TIER_1_RATIO * HISTORY_TIER_2_RATIO, 
+}; 
+
+static const char* const METRIC_NAMES[HISTORY_METRIC_COUNT] = {
+    #define X(id, source)   #source, 
+        HISTORY_SEN6X_METRICS
+        HISTORY_ADC_METRICS
+    #undef X
+}; 
+
+
+static void ref_add(HISTORY_METRIC_t metric, int32_t value)
+{
+    HISTORY_ACC_t*  acc; 
+    uint32_t        tier; 
+    
+    for (tier = 0; tier < HISTORY_TIER_COUNT; tier += 1)
+    {
+        acc = &reference[metric][tier].open; 
+        if (acc->count == 0 || value < acc->min)
+            acc->min = value; 
+        
+        if (acc->count == 0 || value > acc->max)
+            acc->max = value; 
+        
+        acc->sum   += value; 
+        acc->count += 1; 
+    }
+}
+
+
+/// @brief closes the reference buckets ending at second t. 
+static void ref_close(uint32_t t)
+{
+    REF_TIER_t* ref; 
+    uint32_t    metric; 
+    uint32_t    tier; 
+    
+    for (tier = 0; tier < HISTORY_TIER_COUNT; tier += 1)
+    {
+        if (t % TIER_SECONDS[tier] != 0)
+            continue; 
+        
+        for (metric = 0; metric < HISTORY_METRIC_COUNT; metric += 1)
+        {
+            ref = &reference[metric][tier]; 
+            ref->closed[ref->count % REF_BUCKETS] = ref->open; 
+            ref->count += 1; 
+            ref->open   = (HISTORY_ACC_t){0}; 
+        }
+    }
+}
+
+
+/// @brief mean rounded half away from zero. 
+static int32_t ref_mean(const HISTORY_ACC_t* acc)
+{
+    if (acc->sum >= 0)
+        return (acc->sum + acc->count / 2) / acc->count; 
+    
+    return (acc->sum - (int64_t)(acc->count / 2)) / acc->count; 
+}
+
+
+//* _ SIGNALS __________________________________________________________________
+
+static int32_t noise(int32_t amplitude)
+{
+    return (int32_t)(test_random() % (2 * amplitude + 1)) - amplitude; 
+}
+
+
+/// @brief one SEN6x sample per second, each metric has its own shape. 
+static void sen6x_sample(uint32_t t)
+{
+    static int32_t walk = 5000; 
+    
+    walk += noise(3); 
+    
+    // Steady, as in a clean room. 
+    SEN6X_data.PM_2_5   = (MEASUREMENT_t){ .raw = 42, .is_valid = true }; 
+    // Daily cycle around 0 C with sensor noise, negative half the time. 
+    SEN6X_data.temp     = (MEASUREMENT_t){ .raw = (int32_t)(1000 * sin(t * 2 * M_PI / 86400)) + noise(4), .is_valid = true }; 
+    // Slow random walk. 
+    SEN6X_data.humidity = (MEASUREMENT_t){ .raw = walk, .is_valid = true }; 
+    // Missing for 10 minutes every 2 hours. 
+    SEN6X_data.VOC      = (MEASUREMENT_t){ .raw = 1000 + noise(20), .is_valid = t % 7200 >= 600 }; 
+    // Flat with rare steps. 
+    SEN6X_data.NOx      = (MEASUREMENT_t){ .raw = 10 + 10 * ((t / 5000) % 3), .is_valid = true }; 
+    // Spikes of several thousands ppm. 
+    SEN6X_data.CO2      = (MEASUREMENT_t){ .raw = (test_random() % 500 == 0) ? 40000 : 600 + noise(10), .is_valid = true }; 
+    SEN6X_data.sequence += 1; 
+    
+    #define X(id, source)   if (SEN6X_data.source.is_valid)         \
+                                ref_add(id, SEN6X_data.source.raw); 
+        HISTORY_SEN6X_METRICS
+    #undef X
+}
+
+
+/// @brief one ADC scan, converted twice per second. 
+static void adc_scan(void)
+{
+    ADC_data[ADC_H2S].ema_filtered_data             = 10000 + noise(8); 
+    ADC_data[ADC_O2].ema_filtered_data              = 9600 + noise(160); 
+    ADC_data[ADC_CO].ema_filtered_data              = test_random() & 0x3FFF; 
+    ADC_data[ADC_FLAMMABLE_GASES].ema_filtered_data = 10020; 
+    
+    #define X(id, source)   ADC_data[source].data_is_new = true;    \
+                            ref_add(id, ADC_data[source].ema_filtered_data); 
+        HISTORY_ADC_METRICS
+    #undef X
+}
+
+
+//* _ CHECKS ___________________________________________________________________
+
+static void check_tier(HISTORY_METRIC_t metric, HISTORY_TIER_t tier)
+{
+    static HISTORY_BUCKET_t buckets[REF_BUCKETS]; 
+    const REF_TIER_t*       ref = &reference[metric][tier]; 
+    const HISTORY_ACC_t*    acc; 
+    uint32_t                count; 
+    uint32_t                i; 
+    
+    count = HISTORY_read(metric, tier, buckets, REF_BUCKETS); 
+    CHECK(count == rings[metric][tier].count && count <= ref->count, 
+          "%s tier %d: %u buckets read", METRIC_NAMES[metric], tier, count); 
+    CHECK(HISTORY_sequence(tier) == ref->count, "tier %d: sequence %u instead of %u", 
+          tier, HISTORY_sequence(tier), ref->count); 
+    
+    // The newest buckets are read, oldest first. 
+    for (i = 0; i < count && i < ref->count; i += 1)
+    {
+        acc = &ref->closed[(ref->count - count + i) % REF_BUCKETS]; 
+        if (acc->count == 0)
+        {
+            CHECK(buckets[i].is_empty, "%s tier %d bucket %u: not empty", METRIC_NAMES[metric], tier, i); 
+            continue; 
+        }
+        
+        CHECK(!buckets[i].is_empty 
+              && buckets[i].min == acc->min && buckets[i].max == acc->max 
+              && buckets[i].mean == ref_mean(acc), 
+              "%s tier %d bucket %u: %d/%d/%d instead of %d/%d/%d", METRIC_NAMES[metric], tier, i, 
+              buckets[i].min, buckets[i].mean, buckets[i].max, acc->min, ref_mean(acc), acc->max); 
+        
+        if (test_failures > 20)
+            exit(test_report("history")); 
+    }
+}
+
+
+static void check_all(void)
+{
+    uint32_t metric; 
+    uint32_t tier; 
+    
+    for (metric = 0; metric < HISTORY_METRIC_COUNT; metric += 1)
+        for (tier = 0; tier < HISTORY_TIER_COUNT; tier += 1)
+            check_tier(metric, tier); 
+}
+
+
+/// @brief time kept by every tier of each metric, a steady signal keeps the 
+///        whole documented duration. 
+static void report_retention(void)
+{
+    uint32_t metric; 
+    uint32_t buckets; 
+    uint32_t bytes = 0; 
+    
+    printf("  %-20s %10s %10s %10s\n", "retention", "1 s", "5 min", "1 h"); 
+    for (metric = 0; metric < HISTORY_METRIC_COUNT; metric += 1)
+    {
+        printf("  %-20s %8.1f m %8.1f h %8.1f d\n", METRIC_NAMES[metric], 
+               rings[metric][HISTORY_TIER_1S].count / 60.0, 
+               rings[metric][HISTORY_TIER_5MIN].count * 5 / 60.0, 
+               rings[metric][HISTORY_TIER_1H].count / 24.0); 
+    }
+    
+    CHECK(rings[HISTORY_PM_2_5][HISTORY_TIER_1S].count >= 600, "steady signal keeps less than 10 min"); 
+    CHECK(rings[HISTORY_PM_2_5][HISTORY_TIER_5MIN].count >= 288, "steady signal keeps less than 24 h"); 
+    CHECK(rings[HISTORY_PM_2_5][HISTORY_TIER_1H].count >= 7 * 24, "steady signal keeps less than 7 days"); 
+    
+    // Same buckets stored as plain min, mean and max. 
+    for (metric = 0; metric < HISTORY_METRIC_COUNT; metric += 1)
+    {
+        buckets  = rings[metric][HISTORY_TIER_1S].count + rings[metric][HISTORY_TIER_5MIN].count 
+                 + rings[metric][HISTORY_TIER_1H].count; 
+        bytes   += buckets * RAW_BUCKET_SIZE; 
+    }
+    
+    printf("  footprint: %zu bytes of rings, %zu bytes of state, budget %d bytes\n", 
+           sizeof(tier_0_data) + sizeof(tier_1_data) + sizeof(tier_2_data), 
+           sizeof(rings) + sizeof(accumulators), HISTORY_RAM_BUDGET); 
+    printf("  the same buckets stored raw take %u bytes\n", bytes); 
+}
+
+
+int main(int argc, char** argv)
+{
+    uint32_t t; 
+    
+    CHECK(sizeof(tier_0_data) + sizeof(tier_1_data) + sizeof(tier_2_data) 
+          + sizeof(rings) + sizeof(accumulators) <= HISTORY_RAM_BUDGET, "over the RAM budget"); 
+    
+    host_millis = 0; 
+    HISTORY_task(); 
+    
+    for (t = 0; t < SIM_SECONDS; t += 1)
+    {
+        // Close the bucket of the previous second, then feed this one. 
+        host_millis = t * 1000; 
+        HISTORY_task(); 
+        if (t > 0)
+            ref_close(t); 
+        
+        sen6x_sample(t); 
+        adc_scan(); 
+        HISTORY_task(); 
+        
+        host_millis += 500; 
+        adc_scan(); 
+        HISTORY_task(); 
+        
+        if (t % CHECK_PERIOD_S == CHECK_PERIOD_S - 1)
+            check_all(); 
+    }
+    
+    report_retention(); 
+    return test_report("history"); 
+}
@@ -0,0 +1,273 @@
+// Golden image test of the UI: every page of PAGES_LUT is drawn on a fixed
+// scene, sent through the emulated display and compared with its reference
+// image in golden/. The render time of each page is reported. 
+//
+//   build/test_pages --update     rewrites the reference images. 
+//
+// The scene stands in for the drivers that aren't built on the host. 
+
+#include "test.h"
+#include "fake.h"
+#include "ui/pages.h"
+
+#define GOLDEN_DIR          "golden"
+#define PGM_MAX_VALUE       15
+#define PGM_SIZE            (DISPLAY_WIDTH * DISPLAY_HEIGHT)
+#define HISTORY_SECONDS     (3 * 3600)
+#define RENDER_COUNT        200
+#define BENCH_RENDER_COUNT  5000
+#define SETTINGS_PAGE       PAGE_11
+
+
+//* _ SCENE ____________________________________________________________________
+
+SEN6X_DATA_t            SEN6X_data; 
+SEN6X_DIAG_t            SEN6X_diag  = { .nack_count = 3, .crc_count = 1, .stale_count = 2 }; 
+const SEN6X_MODEL_t*    SEN6X_model = &(const SEN6X_MODEL_t){ .name = "SEN66" }; 
+
+volatile ADC_RAW_DATA_t ADC_data[ADC_CHANNEL_COUNT]; 
+volatile uint32_t       ADC_scan_sequence = 0; 
+
+M95_STATUS_t            M95_status  = { .signal_strength = 20 }; 
+MQTT_CONN_STATUS_t      MQTT_status = { .mqtt_is_open = true, .mqtt_is_conn = true }; 
+bool                    speaker_is_active = true; 
+
+extern PAGE_INDEX_t     curr_page; 
+
+
+void BUZZER_toggle_mute(void)
+{
+    speaker_is_active = !speaker_is_active; 
+    return; 
+}
+
+
+static void measurement_set(MEASUREMENT_t* measurement, int32_t raw, uint16_t divider)
+{
+    measurement->raw          = raw; 
+    measurement->divider      = divider; 
+    measurement->is_available = true; 
+    measurement->is_valid     = true; 
+    return; 
+}
+
+
+/// @brief one SEN6x sample and one ADC scan at second t of the scene, slow 
+///        deterministic waves so the charts have a shape. 
+static void scene_sample(uint32_t t)
+{
+    int32_t wave = (int32_t)((t / 60) % 40) - 20;   // Minutes, -20 to 19. 
+    
+    measurement_set(&SEN6X_data.PM_0_5,   1234 + 3 * wave, 100); 
+    measurement_set(&SEN6X_data.PM_1_0,   152 + wave, 10); 
+    measurement_set(&SEN6X_data.PM_2_5,   184 + 2 * wave * (wave < 0 ? -1 : 1), 10); 
+    measurement_set(&SEN6X_data.PM_4_0,   201, 10); 
+    measurement_set(&SEN6X_data.PM_10_0,  213, 10); 
+    measurement_set(&SEN6X_data.humidity, 4625, 100); 
+    measurement_set(&SEN6X_data.temp,     4310, 200); 
+    measurement_set(&SEN6X_data.VOC,      1010, 10); 
+    measurement_set(&SEN6X_data.NOx,      10, 10); 
+    measurement_set(&SEN6X_data.CO2,      612 + 4 * wave, 1); 
+    SEN6X_data.sequence     += 1; 
+    SEN6X_data.timestamp_ms  = host_millis; 
+    
+    // Gas amplifiers a little above their zero offset, battery in percent. 
+    ADC_data[ADC_H2S].ema_filtered_data             = 10160; 
+    ADC_data[ADC_O2].ema_filtered_data              = 9520; 
+    ADC_data[ADC_CO].ema_filtered_data              = 10440; 
+    ADC_data[ADC_FLAMMABLE_GASES].ema_filtered_data = 10020; 
+    ADC_data[ADC_BATTERY_CHARGE].data               = 57; 
+    for (uint32_t i = 0; i < ADC_CHANNEL_COUNT; i += 1)
+        ADC_data[i].data_is_new = true; 
+    
+    ADC_scan_sequence += 1; 
+    return; 
+}
+
+
+/// @brief runs the scene for a few hours of history. 
+static void scene_run(void)
+{
+    uint32_t t; 
+    
+    for (t = 0; t < HISTORY_SECONDS; t += 1)
+    {
+        host_millis = t * 1000; 
+        scene_sample(t); 
+        HISTORY_task(); 
+    }
+    
+    GAS_sensors_process(); 
+    return; 
+}
+
+
+//* _ FRAMES ___________________________________________________________________
+
+/// @brief sends the frame like the main loop, then reads the screen back 
+///        from the controller RAM, one byte per pixel. 
+static void frame_capture(uint8_t* pixels)
+{
+    uint32_t row; 
+    uint32_t col; 
+    uint32_t i; 
+    
+    SSD1362_refresh(); 
+    for (i = 0; i < 100; i += 1)
+    {
+        SSD1362_task(); 
+        host_dma_run(); 
+        host_millis += 1; 
+    }
+    
+    for (row = 0; row < HOST_DISPLAY_ROWS; row += 1)
+    {
+        for (col = 0; col < HOST_DISPLAY_COLUMNS; col += 1)
+        {
+            pixels[row * DISPLAY_WIDTH + col * 2]     = host_display_gddram[row][col] >> 4; 
+            pixels[row * DISPLAY_WIDTH + col * 2 + 1] = host_display_gddram[row][col] & 0x0F; 
+        }
+    }
+    
+    return; 
+}
+
+
+static bool pgm_write(const char* path, const uint8_t* pixels)
+{
+    FILE* file = fopen(path, "wb"); 
+    bool  is_written; 
+    
+    if (file == NULL)
+        return false; 
+    
+    fprintf(file, "P5\n%d %d\n%d\n", DISPLAY_WIDTH, DISPLAY_HEIGHT, PGM_MAX_VALUE); 
+    is_written = fwrite(pixels, 1, PGM_SIZE, file) == PGM_SIZE; 
+    fclose(file); 
+    return is_written; 
+}
+
+
+static bool pgm_read(const char* path, uint8_t* pixels)
+{
+    FILE* file = fopen(path, "rb"); 
+    int   width, height, max_value; 
+    bool  is_read; 
+    
+    if (file == NULL)
+        return false; 
+    
+    is_read = fscanf(file, "P5 %d %d %d", &width, &height, &max_value) == 3 
+           && fgetc(file) != EOF 
+           && width == DISPLAY_WIDTH && height == DISPLAY_HEIGHT && max_value == PGM_MAX_VALUE 
+           && fread(pixels, 1, PGM_SIZE, file) == PGM_SIZE; 
+    fclose(file); 
+    return is_read; 
+}
+
+
+/// @brief compares a page with its reference image, the frame is saved in 
+///        build/ when it differs. 
+static void page_check(uint32_t page, const uint8_t* pixels, bool is_update)
+{
+    static uint8_t  golden[PGM_SIZE]; 
+    char            path[64]; 
+    uint32_t        diff = 0; 
+    uint32_t        i; 
+    
+    snprintf(path, sizeof(path), GOLDEN_DIR "/page_%02u.pgm", page + 1); 
+    if (is_update)
+    {
+        CHECK(pgm_write(path, pixels), "can't write %s", path); 
+        return; 
+    }
+    
+    if (!pgm_read(path, golden))
+    {
+        CHECK(false, "no reference image %s, run build/test_pages --update", path); 
+        return; 
+    }
+    
+    for (i = 0; i < PGM_SIZE; i += 1)
+        diff += golden[i] != pixels[i]; 
+    
+    if (diff == 0)
+        return; 
+    
+    snprintf(path, sizeof(path), "build/page_%02u.pgm", page + 1); 
+    pgm_write(path, pixels); 
+    CHECK(false, "page %u: %u pixels differ from the reference, see %s", page + 1, diff, path); 
+}
+
+
+/// @brief the settings widget has no value to compare, drawing its page 
+///        again must repaint it over whatever covers the slot. 
+static void settings_repaint_check(uint8_t* pixels, bool is_update)
+{
+    if (is_update)
+        return; 
+    
+    display_draw_fillrect(
+        LEFT_WIDGET_X_POS, LEFT_WIDGET_Y_POS, 
+        PAGE_WIDTH, PAGE_HEIGHT, 
+        MAX_INTENSITY
+    ); 
+    display_page(); 
+    frame_capture(pixels); 
+    page_check(SETTINGS_PAGE, pixels, false); 
+    return; 
+}
+
+
+/// @brief average time of a full redraw of the page. 
+static double page_render_us(uint32_t count)
+{
+    uint64_t start; 
+    uint32_t i; 
+    
+    start = test_now_ns(); 
+    for (i = 0; i < count; i += 1)
+    {
+        page_invalidate(); 
+        display_page(); 
+    }
+    
+    return (test_now_ns() - start) / 1000.0 / count; 
+}
+
+
+int main(int argc, char** argv)
+{
+    static uint8_t  pixels[PGM_SIZE]; 
+    bool            is_update = argc > 1 && strcmp(argv[1], "--update") == 0; 
+    uint32_t        count     = test_is_bench(argc, argv) ? BENCH_RENDER_COUNT : RENDER_COUNT; 
+    uint32_t        page; 
+    
+    ssd1362_init(); 
+    scene_run(); 
+    
+    for (page = 0; page < PAGE_COUNT; page += 1)
+    {
+        // Pages without a widget on the scene are skipped like on the device. 
+        curr_page = page; 
+        display_fill(MIN_INTENSITY); 
+        menu_widget_invalidate(); 
+        page_invalidate(); 
+        draw_menu_widget(0, 0, 57); 
+        display_page(); 
+        if (curr_page != page)
+        {
+            printf("  page %2u: not shown\n", page + 1); 
+            continue; 
+        }
+        
+        frame_capture(pixels); 
+        page_check(page, pixels, is_update); 
+        if (page == SETTINGS_PAGE)
+            settings_repaint_check(pixels, is_update); 
+        
+        printf("  page %2u: %7.2f us per full redraw\n", page + 1, page_render_us(count)); 
+    }
+    
+    return test_report("pages"); 
+}
@@ -0,0 +1,177 @@
+// One SEN66 sample through the whole measurement pipeline: the
+// READ_MEASURED frame is decoded and published, the alert thresholds are
+// checked and the page showing the sample is drawn. The samples alternate
+// between a clean one and one over the PM2.5 and CO2 thresholds, so every
+// pass changes the alerts and redraws the widgets. 
+//
+// 'make bench' times each step of the pass. For reference, the same pass on
+// the float measurements they replaced took, on an x86-64 host with an FPU:
+// parse 281 ns, alert 70 ns, page 3269 ns, pass 3620 ns. The M23 has no FPU,
+// its gap is wider. 
+//
+// The driver is included to reach its parse state, the bus is never used. 
+
+#include "test.h"
+#include "fake.h"
+#include "drivers/sen6x.c"
+#include "processes/alert.h"
+#include "ui/pages.h"
+
+#define PASS_COUNT          100
+#define BENCH_PASS_COUNT    200000
+#define SEN66_WORDS         9
+
+
+//* _ SCENE ____________________________________________________________________
+
+volatile ADC_RAW_DATA_t ADC_data[ADC_CHANNEL_COUNT]; 
+volatile uint32_t       ADC_scan_sequence = 0; 
+
+M95_STATUS_t            M95_status  = { .signal_strength = 20 }; 
+MQTT_CONN_STATUS_t      MQTT_status = { .mqtt_is_open = true, .mqtt_is_conn = true }; 
+bool                    speaker_is_active = true; 
+
+extern PAGE_INDEX_t     curr_page; 
+
+
+void BUZZER_toggle_mute(void)
+{
+    speaker_is_active = !speaker_is_active; 
+    return; 
+}
+
+
+//* _ BUS STUBS ________________________________________________________________
+
+bool I2C_submit(const I2C_TRANSACTION_t* transaction)
+{
+    return false; 
+}
+
+
+bool I2C_is_idle(void)
+{
+    return true; 
+}
+
+
+void I2C_bus_recover(void)
+{
+    return; 
+}
+
+
+//* _ FRAMES ___________________________________________________________________
+
+// PM1.0, PM2.5, PM4.0, PM10, RH, T, VOC, NOx and CO2 in sensor ticks. The 
+// second sample has 30.0 ug/m3 of PM2.5 and 5200 ppm of CO2. 
+static const uint16_t CLEAN_WORDS[SEN66_WORDS] = { 123, 150, 171, 182, 4567, 4700, 1000, 10, 612 }; 
+static const uint16_t ALERT_WORDS[SEN66_WORDS] = { 123, 300, 171, 182, 4567, 4700, 1000, 10, 5200 }; 
+
+static uint8_t clean_frame[SEN66_WORDS * SEN6X_WORD_LENGTH]; 
+static uint8_t alert_frame[SEN66_WORDS * SEN6X_WORD_LENGTH]; 
+
+
+/// @brief builds the frame the sensor sends for the words, CRC included. 
+static void frame_build(uint8_t* frame, const uint16_t* words)
+{
+    uint32_t i; 
+    
+    for (i = 0; i < SEN66_WORDS; i += 1)
+    {
+        frame[i * SEN6X_WORD_LENGTH]     = words[i] >> 8; 
+        frame[i * SEN6X_WORD_LENGTH + 1] = words[i] & 0xFF; 
+        frame[i * SEN6X_WORD_LENGTH + 2] = crc_8_check(&frame[i * SEN6X_WORD_LENGTH], 2); 
+    }
+    
+    return; 
+}
+
+
+//* _ PIPELINE _________________________________________________________________
+
+typedef struct
+{
+    uint64_t parse_ns; 
+    uint64_t alert_ns; 
+    uint64_t page_ns; 
+}   PIPELINE_TIME_t; 
+
+
+/// @brief receives a frame and runs it through the pipeline like the main 
+///        loop, adding the time of each step. 
+static void pipeline_pass(const uint8_t* frame, PIPELINE_TIME_t* time)
+{
+    uint64_t start; 
+    uint64_t parsed; 
+    uint64_t checked; 
+    
+    memcpy(rx_buffer, frame, SEN66_WORDS * SEN6X_WORD_LENGTH); 
+    
+    start = test_now_ns(); 
+    SEN6X_PARSE_DATA_state(); 
+    parsed = test_now_ns(); 
+    check_alert_threshold(); 
+    checked = test_now_ns(); 
+    display_page(); 
+    
+    time->page_ns  += test_now_ns() - checked; 
+    time->alert_ns += checked - parsed; 
+    time->parse_ns += parsed - start; 
+    return; 
+}
+
+
+static void pipeline_run(uint32_t count, PIPELINE_TIME_t* time)
+{
+    uint32_t i; 
+    
+    *time = (PIPELINE_TIME_t){0}; 
+    for (i = 0; i < count; i += 1)
+    {
+        pipeline_pass(clean_frame, time); 
+        CHECK(SEN6X_data.PM_2_5.raw == 150 && SEN6X_data.PM_2_5.is_valid, "clean sample, PM2.5 %d", SEN6X_data.PM_2_5.raw); 
+        CHECK(!alert_detected.pm_2_5 && !alert_detected.co2, "clean sample raised an alert 0x%X", alert_detected.alert); 
+        
+        pipeline_pass(alert_frame, time); 
+        CHECK(SEN6X_data.CO2.raw == 5200 && SEN6X_data.CO2.is_valid, "alert sample, CO2 %d", SEN6X_data.CO2.raw); 
+        CHECK(alert_detected.pm_2_5 && alert_detected.co2, "alert sample, alerts 0x%X", alert_detected.alert); 
+        
+        // Stop at the first broken pass instead of repeating its failures. 
+        if (test_failures)
+            return; 
+    }
+    
+    return; 
+}
+
+
+int main(int argc, char** argv)
+{
+    PIPELINE_TIME_t time; 
+    uint32_t        count = test_is_bench(argc, argv) ? BENCH_PASS_COUNT : PASS_COUNT; 
+    double          passes; 
+    
+    frame_build(clean_frame, CLEAN_WORDS); 
+    frame_build(alert_frame, ALERT_WORDS); 
+    
+    SEN6X_model = &SEN6X_MODEL_LUT[SEN66]; 
+    SEN6X_data_init(&back_buffer, SEN6X_model); 
+    
+    ssd1362_init(); 
+    display_fill(MIN_INTENSITY); 
+    curr_page = PAGE_2; 
+    
+    pipeline_run(count, &time); 
+    CHECK(SEN6X_data.sequence == 2 * count, "%u samples published for %u", SEN6X_data.sequence, 2 * count); 
+    
+    if (test_is_bench(argc, argv))
+    {
+        passes = 2.0 * count; 
+        printf("  parse %.1f ns, alert %.1f ns, page %.1f ns, pass %.1f ns\n", 
+               time.parse_ns / passes, time.alert_ns / passes, time.page_ns / passes, 
+               (time.parse_ns + time.alert_ns + time.page_ns) / passes); 
+    }
+    
+    return test_report("pipeline"); 
+}
@@ -0,0 +1,146 @@
+// Run-length encoded assets: compression ratio against the raw 4bpp arrays,
+// same pixels as the raw blit at any position, and benchmark of both blits. 
+//
+// The driver is included to reach the framebuffer. 
+
+#include "test.h"
+#include "drivers/ssd1362.c"
+#include "ui/assets.h"
+#include "utils/utils.h"
+
+#define BENCH_COUNT     200000
+
+typedef struct
+{
+    const char*     name; 
+    const uint8_t*  rle; 
+    uint32_t        width; 
+    uint32_t        height; 
+}   RLE_ASSET_t; 
+
+static const RLE_ASSET_t RLE_ASSETS[] = {
+    { "MENU_LEFT",  MENU_LEFT_ASSET,  MENU_LEFT_WIDTH,  MENU_LEFT_HEIGHT }, 
+    { "MENU_RIGHT", MENU_RIGHT_ASSET, MENU_RIGHT_WIDTH, MENU_RIGHT_HEIGHT }, 
+}; 
+
+
+/// @brief decodes an asset to the raw layout of display_img(). 
+/// @return the size of the encoded asset. 
+static uint32_t rle_decode(const RLE_ASSET_t* asset, uint8_t* raw)
+{
+    const uint8_t*  src    = asset->rle; 
+    uint32_t        pixels = ((asset->width + 1) & ~1u) * asset->height; 
+    uint32_t        pixel  = 0; 
+    uint32_t        count; 
+    uint32_t        i; 
+    uint8_t         token; 
+    uint8_t         value; 
+    
+    memset(raw, 0, pixels / 2); 
+    while (pixel < pixels)
+    {
+        token = *src++; 
+        count = (token & RLE_COUNT_MASK) + 1; 
+        
+        for (i = 0; i < count && pixel < pixels; i += 1, pixel += 1)
+        {
+            if (token & RLE_LITERAL_FLAG)
+                value = (i % 2) ? (src[i / 2] & 0x0F) : (src[i / 2] >> 4); 
+            else
+                value = *src & 0x0F; 
+            
+            raw[pixel / 2] |= (pixel % 2) ? value : value << 4; 
+        }
+        
+        src += (token & RLE_LITERAL_FLAG) ? (count + 1) / 2 : 1; 
+    }
+    
+    return src - asset->rle; 
+}
+
+
+static void check_asset(const RLE_ASSET_t* asset, const uint8_t* raw)
+{
+    static PIXEL_INTENSITY_t    expected[BUFFER_SIZE]; 
+    uint32_t                    x, y; 
+    uint32_t                    i; 
+    
+    // Every odd and even position, including the clipped ones. 
+    for (i = 0; i < 500; i += 1)
+    {
+        x = test_random() % DISPLAY_WIDTH; 
+        y = test_random() % DISPLAY_HEIGHT; 
+        if (i < 4)
+            x = i; 
+        
+        display_fill(test_random() & 0x0F); 
+        display_img(x, y, asset->width, asset->height, raw); 
+        memcpy(expected, framebuffer, sizeof(expected)); 
+        
+        display_fill(expected[0].first_pixel); 
+        display_img_rle(x, y, asset->width, asset->height, asset->rle); 
+        
+        CHECK(memcmp(expected, framebuffer, sizeof(expected)) == 0, 
+              "%s at (%u, %u) differs from the raw blit", asset->name, x, y); 
+    }
+}
+
+
+static void bench_asset(const RLE_ASSET_t* asset, const uint8_t* raw)
+{
+    uint64_t start; 
+    uint64_t raw_ns; 
+    uint64_t rle_ns; 
+    long     i; 
+    
+    start = test_now_ns(); 
+    for (i = 0; i < BENCH_COUNT; i += 1)
+        display_img(i & 1, 0, asset->width, asset->height, raw); 
+    raw_ns = test_now_ns() - start; 
+    
+    start = test_now_ns(); 
+    for (i = 0; i < BENCH_COUNT; i += 1)
+        display_img_rle(i & 1, 0, asset->width, asset->height, asset->rle); 
+    rle_ns = test_now_ns() - start; 
+    
+    printf("  %-10s raw %6.0f ns/blit, rle %6.0f ns/blit\n", 
+           asset->name, (double)raw_ns / BENCH_COUNT, (double)rle_ns / BENCH_COUNT); 
+}
+
+
+int main(int argc, char** argv)
+{
+    static uint8_t  raw[BUFFER_SIZE]; 
+    uint32_t        raw_size; 
+    uint32_t        rle_size; 
+    uint32_t        raw_total = 0; 
+    uint32_t        rle_total = 0; 
+    uint32_t        i; 
+    
+    for (i = 0; i < ARRAY_SIZE(RLE_ASSETS); i += 1)
+    {
+        raw_size = (RLE_ASSETS[i].width + 1) / 2 * RLE_ASSETS[i].height; 
+        rle_size = rle_decode(&RLE_ASSETS[i], raw); 
+        
+        if (test_is_bench(argc, argv))
+        {
+            bench_asset(&RLE_ASSETS[i], raw); 
+            continue; 
+        }
+        
+        printf("  %-10s %5u bytes raw, %5u bytes rle (%.1f %%)\n", 
+               RLE_ASSETS[i].name, raw_size, rle_size, 100.0 * rle_size / raw_size); 
+        CHECK(rle_size < raw_size, "%s is larger than raw", RLE_ASSETS[i].name); 
+        check_asset(&RLE_ASSETS[i], raw); 
+        
+        raw_total += raw_size; 
+        rle_total += rle_size; 
+    }
+    
+    if (test_is_bench(argc, argv))
+        return 0; 
+    
+    printf("  total      %5u bytes raw, %5u bytes rle (%.1f %%)\n", 
+           raw_total, rle_total, 100.0 * rle_total / raw_total); 
+    return test_report("rle"); 
+}
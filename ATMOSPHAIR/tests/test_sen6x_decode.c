@@ -0,0 +1,263 @@
+// READ_MEASURED frames of every SEN6x model through the table-driven
+// decoder: values, scales and signs of each field, fields the model doesn't
+// provide, corrupted words and unknown values. 
+//
+// The frames are the bytes the sensors send, CRC included. The driver is 
+// included to reach the decoder, the bus is never used. 
+
+#include "test.h"
+#include "drivers/sen6x.c"
+
+
+//* _ BUS STUBS ________________________________________________________________
+
+bool I2C_submit(const I2C_TRANSACTION_t* transaction)
+{
+    return false; 
+}
+
+
+bool I2C_is_idle(void)
+{
+    return true; 
+}
+
+
+void I2C_bus_recover(void)
+{
+    return; 
+}
+
+
+//* _ FRAMES ___________________________________________________________________
+
+typedef struct
+{
+    MEASUREMENT_t*  dest; 
+    int32_t         raw; 
+    uint16_t        divider; 
+}   EXPECTED_FIELD_t; 
+
+typedef struct
+{
+    SEN6X_MODEL_ID_t        model; 
+    const uint8_t*          frame; 
+    const EXPECTED_FIELD_t* fields; 
+    uint32_t                field_count; 
+}   RECORDED_FRAME_t; 
+
+// PM1.0 12.3, PM2.5 15.0, PM4.0 17.1 and PM10 18.2 ug/m3 for every model. 
+#define PM_FIELDS   { &back_buffer.PM_1_0,  123, 10 }, \
+                    { &back_buffer.PM_2_5,  150, 10 }, \
+                    { &back_buffer.PM_4_0,  171, 10 }, \
+                    { &back_buffer.PM_10_0, 182, 10 }
+
+static const uint8_t SEN60_FRAME[] = {
+    0x00, 0x7B, 0x93, 0x00, 0x96, 0x1E, 0x00, 0xAB, 0x97, 0x00, 0xB6, 0x98, 
+    0x04, 0xD2, 0x64, 
+}; 
+
+static const EXPECTED_FIELD_t SEN60_EXPECTED[] = {
+    PM_FIELDS, 
+    { &back_buffer.PM_0_5, 1234, 100 }, 
+}; 
+
+// 45.67 %RH, -5.5 C, 612 ppm. 
+static const uint8_t SEN63C_FRAME[] = {
+    0x00, 0x7B, 0x93, 0x00, 0x96, 0x1E, 0x00, 0xAB, 0x97, 0x00, 0xB6, 0x98, 
+    0x11, 0xD7, 0x88, 0xFB, 0xB4, 0xF8, 0x02, 0x64, 0x27, 
+}; 
+
+static const EXPECTED_FIELD_t SEN63C_EXPECTED[] = {
+    PM_FIELDS, 
+    { &back_buffer.humidity, 4567,  100 }, 
+    { &back_buffer.temp,     -1100, 200 }, 
+    { &back_buffer.CO2,      612,   1 }, 
+}; 
+
+// 45.67 %RH, 23.5 C, VOC index 100, NOx index 1. 
+static const uint8_t SEN65_FRAME[] = {
+    0x00, 0x7B, 0x93, 0x00, 0x96, 0x1E, 0x00, 0xAB, 0x97, 0x00, 0xB6, 0x98, 
+    0x11, 0xD7, 0x88, 0x12, 0x5C, 0x35, 0x03, 0xE8, 0xD4, 0x00, 0x0A, 0x5A, 
+}; 
+
+static const EXPECTED_FIELD_t SEN65_EXPECTED[] = {
+    PM_FIELDS, 
+    { &back_buffer.humidity, 4567, 100 }, 
+    { &back_buffer.temp,     4700, 200 }, 
+    { &back_buffer.VOC,      1000, 10 }, 
+    { &back_buffer.NOx,      10,   10 }, 
+}; 
+
+// SEN65 fields then 612 ppm CO2. 
+static const uint8_t SEN66_FRAME[] = {
+    0x00, 0x7B, 0x93, 0x00, 0x96, 0x1E, 0x00, 0xAB, 0x97, 0x00, 0xB6, 0x98, 
+    0x11, 0xD7, 0x88, 0x12, 0x5C, 0x35, 0x03, 0xE8, 0xD4, 0x00, 0x0A, 0x5A, 
+    0x02, 0x64, 0x27, 
+}; 
+
+static const EXPECTED_FIELD_t SEN66_EXPECTED[] = {
+    PM_FIELDS, 
+    { &back_buffer.humidity, 4567, 100 }, 
+    { &back_buffer.temp,     4700, 200 }, 
+    { &back_buffer.VOC,      1000, 10 }, 
+    { &back_buffer.NOx,      10,   10 }, 
+    { &back_buffer.CO2,      612,  1 }, 
+}; 
+
+// SEN65 fields then 15.5 ppb HCHO. 
+static const uint8_t SEN68_FRAME[] = {
+    0x00, 0x7B, 0x93, 0x00, 0x96, 0x1E, 0x00, 0xAB, 0x97, 0x00, 0xB6, 0x98, 
+    0x11, 0xD7, 0x88, 0x12, 0x5C, 0x35, 0x03, 0xE8, 0xD4, 0x00, 0x0A, 0x5A, 
+    0x00, 0x9B, 0x52, 
+}; 
+
+static const EXPECTED_FIELD_t SEN68_EXPECTED[] = {
+    PM_FIELDS, 
+    { &back_buffer.humidity, 4567, 100 }, 
+    { &back_buffer.temp,     4700, 200 }, 
+    { &back_buffer.VOC,      1000, 10 }, 
+    { &back_buffer.NOx,      10,   10 }, 
+    { &back_buffer.HCHO,     155,  10 }, 
+}; 
+
+static const RECORDED_FRAME_t RECORDED_FRAMES[] = {
+    { SEN60,  SEN60_FRAME,  SEN60_EXPECTED,  ARRAY_SIZE(SEN60_EXPECTED) }, 
+    { SEN63C, SEN63C_FRAME, SEN63C_EXPECTED, ARRAY_SIZE(SEN63C_EXPECTED) }, 
+    { SEN65,  SEN65_FRAME,  SEN65_EXPECTED,  ARRAY_SIZE(SEN65_EXPECTED) }, 
+    { SEN66,  SEN66_FRAME,  SEN66_EXPECTED,  ARRAY_SIZE(SEN66_EXPECTED) }, 
+    { SEN68,  SEN68_FRAME,  SEN68_EXPECTED,  ARRAY_SIZE(SEN68_EXPECTED) }, 
+}; 
+
+static MEASUREMENT_t* const ALL_FIELDS[] = {
+    &back_buffer.PM_0_5, &back_buffer.PM_1_0, &back_buffer.PM_2_5, &back_buffer.PM_4_0, 
+    &back_buffer.PM_10_0, &back_buffer.humidity, &back_buffer.temp, &back_buffer.VOC, 
+    &back_buffer.NOx, &back_buffer.CO2, &back_buffer.HCHO, 
+}; 
+
+
+//* _ TESTS ____________________________________________________________________
+
+/// @brief tells if a field is part of the expected frame of a model. 
+static const EXPECTED_FIELD_t* expected_find(const RECORDED_FRAME_t* recorded, const MEASUREMENT_t* dest)
+{
+    uint32_t i; 
+    
+    for (i = 0; i < recorded->field_count; i += 1)
+        if (recorded->fields[i].dest == dest)
+            return &recorded->fields[i]; 
+    
+    return NULL; 
+}
+
+
+/// @brief decodes a frame of the model, the diagnostic counters start at 0. 
+static void frame_decode(const RECORDED_FRAME_t* recorded, const uint8_t* frame)
+{
+    const SEN6X_MODEL_t* model = &SEN6X_MODEL_LUT[recorded->model]; 
+    
+    memset(&SEN6X_diag, 0, sizeof(SEN6X_diag)); 
+    SEN6X_data_init(&back_buffer, model); 
+    decode_frame(frame, model->measurement_length, model->fields, model->field_count); 
+    return; 
+}
+
+
+static void check_recorded_frame(const RECORDED_FRAME_t* recorded)
+{
+    const SEN6X_MODEL_t*    model = &SEN6X_MODEL_LUT[recorded->model]; 
+    const EXPECTED_FIELD_t* expected; 
+    uint32_t                i; 
+    
+    CHECK(model->measurement_length == recorded->field_count * SEN6X_WORD_LENGTH, 
+          "%s: frame of %u bytes for %u fields", model->name, model->measurement_length, recorded->field_count); 
+    
+    frame_decode(recorded, recorded->frame); 
+    CHECK(SEN6X_diag.crc_count == 0 && SEN6X_diag.unknown_count == 0, "%s: frame counted as bad", model->name); 
+    
+    for (i = 0; i < ARRAY_SIZE(ALL_FIELDS); i += 1)
+    {
+        expected = expected_find(recorded, ALL_FIELDS[i]); 
+        if (expected == NULL)
+        {
+            CHECK(!ALL_FIELDS[i]->is_available && !ALL_FIELDS[i]->is_valid, 
+                  "%s: field %u isn't sent but is available", model->name, i); 
+            continue; 
+        }
+        
+        CHECK(ALL_FIELDS[i]->is_available && ALL_FIELDS[i]->is_valid, "%s: field %u not valid", model->name, i); 
+        CHECK(ALL_FIELDS[i]->raw == expected->raw && ALL_FIELDS[i]->divider == expected->divider, 
+              "%s: field %u is %d/%u instead of %d/%u", model->name, i, 
+              ALL_FIELDS[i]->raw, ALL_FIELDS[i]->divider, expected->raw, expected->divider); 
+    }
+}
+
+
+/// @brief a corrupted word only invalidates its own field. 
+static void check_corrupted_word(const RECORDED_FRAME_t* recorded)
+{
+    const SEN6X_MODEL_t*    model = &SEN6X_MODEL_LUT[recorded->model]; 
+    uint8_t                 frame[SEN6X_RX_BUF_LENGTH]; 
+    uint32_t                word; 
+    uint32_t                i; 
+    
+    for (word = 0; word < recorded->field_count; word += 1)
+    {
+        memcpy(frame, recorded->frame, model->measurement_length); 
+        frame[word * SEN6X_WORD_LENGTH + (word % 3)] ^= 0x10; 
+        frame_decode(recorded, frame); 
+        
+        CHECK(SEN6X_diag.crc_count == 1, "%s: corrupted word %u not counted", model->name, word); 
+        for (i = 0; i < recorded->field_count; i += 1)
+        {
+            CHECK(recorded->fields[i].dest->is_valid == (i != word), 
+                  "%s: word %u corrupted, field %u valid %d", model->name, word, i, 
+                  recorded->fields[i].dest->is_valid); 
+        }
+    }
+}
+
+
+/// @brief 0xFFFF in unsigned fields and 0x7FFF in signed fields mean the 
+///        value isn't known yet, the field is invalid. 
+static void check_unknown_values(const RECORDED_FRAME_t* recorded)
+{
+    const SEN6X_MODEL_t*    model = &SEN6X_MODEL_LUT[recorded->model]; 
+    const SEN6X_FIELD_t*    field; 
+    uint8_t                 frame[SEN6X_RX_BUF_LENGTH]; 
+    uint8_t*                word; 
+    uint32_t                i; 
+    
+    for (i = 0; i < model->field_count; i += 1)
+    {
+        field = &model->fields[i]; 
+        memcpy(frame, recorded->frame, model->measurement_length); 
+        
+        word    = &frame[field->word * SEN6X_WORD_LENGTH]; 
+        word[0] = field->is_signed ? 0x7F : 0xFF; 
+        word[1] = 0xFF; 
+        word[2] = crc_8_check(word, 2); 
+        frame_decode(recorded, frame); 
+        
+        CHECK(SEN6X_diag.unknown_count == 1 && SEN6X_diag.crc_count == 0, 
+              "%s: unknown word %u not counted", model->name, field->word); 
+        CHECK(!field->dest->is_valid, "%s: unknown word %u is valid", model->name, field->word); 
+    }
+}
+
+
+int main(int argc, char** argv)
+{
+    uint32_t i; 
+    
+    CHECK(ARRAY_SIZE(RECORDED_FRAMES) == SEN6X_MODEL_COUNT, "a model has no recorded frame"); 
+    
+    for (i = 0; i < ARRAY_SIZE(RECORDED_FRAMES); i += 1)
+    {
+        check_recorded_frame(&RECORDED_FRAMES[i]); 
+        check_corrupted_word(&RECORDED_FRAMES[i]); 
+        check_unknown_values(&RECORDED_FRAMES[i]); 
+    }
+    
+    return test_report("sen6x_decode"); 
+}
@@ -0,0 +1,193 @@
+// SEN6x driver, I2C engine and alerts against an emulated SEN66 on SERCOM1 
+// playing scenarios/morning.csv: detection, every decoded sample, the alert 
+// state after each sample, the restart after each bus fault and the bus 
+// recovery. The main loop is run every simulated millisecond, the throughput 
+// of the simulation and the bus load per sample are reported. 
+
+#include "test.h"
+#include "fake.h"
+#include "drivers/sen6x.h"
+#include "processes/alert.h"
+
+#define SCENARIO_PATH       "scenarios/morning.csv"
+#define SAMPLE_PERIOD_MS    1000
+#define STARTUP_MS          5000        // Detection, reset and first sample.
+#define RESTART_MS          15000       // Stale timeout, recoveries and restart after a fault.
+#define MAX_SAMPLE_GAP_MS   (SAMPLE_PERIOD_MS + 100)
+
+
+//* _ EXPECTED VALUES __________________________________________________________
+
+typedef struct
+{
+    MEASUREMENT_t*  dest; 
+    uint16_t        divider; 
+    bool            is_signed; 
+    int32_t         alert_threshold;    ///< 0 if the measurement has no alert. 
+    uint32_t        alert_bit; 
+    const char*     name; 
+}   SEN66_WORD_t; 
+
+// Words of the SEN66 READ_MEASURED frame, in the order of host_sen6x_frame. 
+static const SEN66_WORD_t SEN66_WORDS[HOST_SEN6X_WORDS] = {
+    { &SEN6X_data.PM_1_0,   10,  false, PM_1_0_ALERT_THRESHOLD,  1, "PM1.0" }, 
+    { &SEN6X_data.PM_2_5,   10,  false, PM_2_5_ALERT_THRESHOLD,  2, "PM2.5" }, 
+    { &SEN6X_data.PM_4_0,   10,  false, PM_4_0_ALERT_THRESHOLD,  3, "PM4.0" }, 
+    { &SEN6X_data.PM_10_0,  10,  false, PM_10_0_ALERT_THRESHOLD, 4, "PM10" }, 
+    { &SEN6X_data.humidity, 100, true,  RH_ALERT_THRESHOLD,      5, "RH" }, 
+    { &SEN6X_data.temp,     200, true,  TEMP_ALERT_THRESHOLD,    6, "temp" }, 
+    { &SEN6X_data.VOC,      10,  true,  VOC_ALERT_THRESHOLD,     7, "VOC" }, 
+    { &SEN6X_data.NOx,      10,  true,  NOX_ALERT_THRESHOLD,     8, "NOx" }, 
+    { &SEN6X_data.CO2,      1,   false, CO2_ALERT_THRESHOLD,     9, "CO2" }, 
+}; 
+
+static uint32_t sample_count                     = 0; 
+static uint32_t partial_count                    = 0; 
+static uint32_t alert_raises[HOST_SEN6X_WORDS]   = {0}; 
+static char     serial_number[2 * SEN6X_REQUEST_MAX_WORDS + 1]; 
+
+
+static void serial_number_callback(bool is_success, const uint16_t* words, uint32_t word_count, uintptr_t context)
+{
+    uint32_t i; 
+    
+    for (i = 0; i < word_count; i += 1)
+    {
+        serial_number[2 * i]     = words[i] >> 8; 
+        serial_number[2 * i + 1] = words[i] & 0xFF; 
+    }
+    
+    serial_number[2 * word_count] = '\0'; 
+}
+
+
+/// @brief a new sample is published: its valid fields are the last frame 
+///        sent by the sensor and the alerts follow their thresholds. 
+static void check_sample(void)
+{
+    const SEN66_WORD_t* word; 
+    int32_t             expected; 
+    bool                is_alert; 
+    bool                was_alert; 
+    bool                is_complete = true; 
+    bool                is_empty    = true; 
+    uint32_t            i; 
+    
+    for (i = 0; i < HOST_SEN6X_WORDS; i += 1)
+    {
+        word         = &SEN66_WORDS[i]; 
+        is_complete &= word->dest->is_valid; 
+        is_empty    &= !word->dest->is_valid; 
+        if (!word->dest->is_valid)
+            continue; 
+        
+        expected = word->is_signed ? (int16_t)host_sen6x_frame[i] : host_sen6x_frame[i]; 
+        CHECK(word->dest->raw == expected && word->dest->divider == word->divider, 
+              "%u ms, %s: %d/%u instead of %d/%u", host_millis, word->name, 
+              word->dest->raw, word->dest->divider, expected, word->divider); 
+        
+        is_alert  = (alert_detected.alert >> word->alert_bit) & 1; 
+        was_alert = (alert_raises[i] & 1) != 0; 
+        CHECK(is_alert == (expected > word->alert_threshold * word->divider), 
+              "%u ms, %s alert %d at %d", host_millis, word->name, is_alert, expected); 
+        
+        // Odd count while the alert is raised. 
+        if (is_alert != was_alert)
+            alert_raises[i] += 1; 
+    }
+    
+    // Samples published by a recovery have no valid field. 
+    if (is_empty)
+        return; 
+    
+    sample_count  += 1; 
+    partial_count += !is_complete; 
+}
+
+
+int main(int argc, char** argv)
+{
+    uint32_t duration_s; 
+    uint32_t sequence        = 0; 
+    uint32_t last_sample_ms  = 0; 
+    uint32_t last_fault_ms   = 0; 
+    uint32_t max_gap_ms      = 0; 
+    bool     is_requested    = false; 
+    uint64_t start; 
+    double   elapsed_s; 
+    uint32_t i; 
+    
+    duration_s = host_sen6x_load(SCENARIO_PATH); 
+    CHECK(duration_s > 0, "can't read %s", SCENARIO_PATH); 
+    
+    I2C_init(&I2C_SERCOM1_PLIB); 
+    SEN6X_init(); 
+    
+    start = test_now_ns(); 
+    for (host_millis = 0; host_millis < duration_s * 1000; host_millis += 1)
+    {
+        host_i2c_run(); 
+        I2C_task(); 
+        SEN6X_task(); 
+        check_alert_threshold(); 
+        
+        if (!is_requested && SEN6X_is_ready())
+            is_requested = SEN6X_request(GET_SERIAL_NUMBER, NULL, 0, SEN6X_REQUEST_MAX_WORDS, serial_number_callback, 0); 
+        
+        if (SEN6X_data.sequence != sequence)
+        {
+            sequence = SEN6X_data.sequence; 
+            check_sample(); 
+            if (SEN6X_data.PM_2_5.is_valid)
+                last_sample_ms = host_millis; 
+        }
+        
+        // Outside of the faults, a sample arrives every second. 
+        if (host_sen6x_fault() != HOST_FAULT_NONE)
+            last_fault_ms = host_millis; 
+        
+        if (host_millis >= STARTUP_MS && host_millis - last_fault_ms >= RESTART_MS
+            && host_millis - last_sample_ms > max_gap_ms)
+            max_gap_ms = host_millis - last_sample_ms; 
+    }
+    
+    elapsed_s = (test_now_ns() - start) / 1e9; 
+    
+    CHECK(SEN6X_model && strcmp(SEN6X_model->name, "SEN66") == 0, "SEN66 not detected"); 
+    CHECK(strcmp(serial_number, "HOST-SEN66") == 0, "serial number \"%s\"", serial_number); 
+    CHECK(max_gap_ms <= MAX_SAMPLE_GAP_MS, "%u ms without a sample outside of the faults", max_gap_ms); 
+    CHECK(sample_count >= duration_s * 95 / 100, "%u samples in %u s", sample_count, duration_s); 
+    
+    // Every fault of the scenario is seen and recovered from. 
+    CHECK(SEN6X_diag.nack_count > 0, "no NACK counted"); 
+    CHECK(SEN6X_diag.crc_count > 0, "no CRC error counted"); 
+    CHECK(SEN6X_diag.timeout_count > 0, "no timeout counted"); 
+    CHECK(SEN6X_diag.recovery_count > 0, "no recovery"); 
+    CHECK(host_i2c_recovery_clocks > 0, "SDA never clocked out"); 
+    CHECK(host_port.GROUP[0].PORT_PINCFG[PORT_PIN_PA08] == PORT_PINCFG_PMUXEN_Msk
+          && host_port.GROUP[0].PORT_PINCFG[PORT_PIN_PA09] == PORT_PINCFG_PMUXEN_Msk, 
+          "pins not given back to SERCOM1"); 
+    
+    // The scenario raises then clears these alerts. 
+    CHECK(alert_raises[1] >= 2 && alert_raises[4] >= 2 && alert_raises[6] >= 2 && alert_raises[8] >= 2, 
+          "PM2.5, RH, VOC and CO2 alerts not raised and cleared"); 
+    CHECK(alert_detected.alert == 0, "alerts 0x%03X left at the end", alert_detected.alert); 
+    
+    printf("  %u samples, %u partial, errors:", sample_count, partial_count); 
+    #define X(field, label, key)    printf(" %s %u", key, SEN6X_diag.field);
+        SEN6X_DIAG_COUNTERS
+    #undef X
+    printf("\n  alerts raised:"); 
+    for (i = 0; i < HOST_SEN6X_WORDS; i += 1)
+    {
+        if (alert_raises[i])
+            printf(" %s %u", SEN66_WORDS[i].name, (alert_raises[i] + 1) / 2); 
+    }
+    
+    printf("\n  %u h simulated in %.2f s (x%.0f), %.1f transfers and %.1f bytes per sample, bus busy %.2f %%\n", 
+           duration_s / 3600, elapsed_s, duration_s / elapsed_s, 
+           (double)host_i2c_transfers / sample_count, (double)host_i2c_bytes / sample_count, 
+           host_i2c_busy_us / (duration_s * 1e4)); 
+    
+    return test_report("sen6x_scenario"); 
+}
@@ -0,0 +1,146 @@
+// Partial refresh of the SSD1362: after each frame the emulated controller
+// RAM must hold the frame on screen, and typical page redraws must send a
+// fraction of a full refresh. 
+//
+// The driver is included to reach the front buffer. 
+
+#include "test.h"
+#include "fake.h"
+#include "drivers/ssd1362.c"
+
+
+/// @brief sends the frame drawn so far, like the main loop does. 
+/// @return the framebuffer bytes sent. 
+static uint32_t frame_send(void)
+{
+    uint32_t bytes_sent = SSD1362_stats.bytes_sent; 
+    uint32_t i; 
+    
+    SSD1362_refresh(); 
+    for (i = 0; i < 1000 && (curr_state != SSD1362_READY || refresh_requested); i += 1)
+    {
+        SSD1362_task(); 
+        host_dma_run(); 
+        host_millis += 1; 
+    }
+    
+    CHECK(curr_state == SSD1362_READY, "transfer not finished"); 
+    return SSD1362_stats.bytes_sent - bytes_sent; 
+}
+
+
+/// @brief the controller RAM must match the frame on screen. 
+static bool screen_matches(void)
+{
+    uint32_t row; 
+    uint32_t col; 
+    
+    for (row = 0; row < DISPLAY_LOGICAL_HEIGHT; row += 1)
+        for (col = 0; col < DISPLAY_LOGICAL_WIDTH; col += 1)
+            if (host_display_gddram[row][col] != front_buffer[col + row * DISPLAY_LOGICAL_WIDTH].intensity)
+                return false; 
+    
+    return true; 
+}
+
+
+/// @brief a measurement page: title, frame and four values. 
+static void page_draw(const char* values[4])
+{
+    uint32_t i; 
+    
+    display_fill(MIN_INTENSITY); 
+    display_draw_str(4, 2, "AIR QUALITY", MAX_INTENSITY, FONT_6X8); 
+    display_fast_h_line(0, 11, DISPLAY_WIDTH, HALF_INTENSITY); 
+    
+    for (i = 0; i < 4; i += 1)
+    {
+        display_draw_rounded_rect(i * 64 + 2, 14, 60, 48, 4, QUARTER_INTENSITY); 
+        display_draw_str(i * 64 + 8, 34, values[i], MAX_INTENSITY, FONT_10X16); 
+    }
+    
+    return; 
+}
+
+
+/// @brief redraws one value of the page in place. 
+static void value_draw(uint32_t slot, const char* value)
+{
+    display_draw_fillrect(slot * 64 + 8, 34, 50, 16, MIN_INTENSITY); 
+    display_draw_str(slot * 64 + 8, 34, value, MAX_INTENSITY, FONT_10X16); 
+    return; 
+}
+
+
+/// @brief prints the traffic of a redraw against a full refresh. 
+static void report(const char* name, uint32_t bytes)
+{
+    printf("  %-28s %5u bytes, %5.1f %% of a full refresh\n", 
+            name, bytes, 100.0 * bytes / (BUFFER_SIZE)); 
+    return; 
+}
+
+
+int main(int argc, char** argv)
+{
+    const char* values[4]     = { "412", "20.9", "3", "0" }; 
+    const char* new_values[4] = { "415", "20.9", "3", "0" }; 
+    uint32_t    bytes; 
+    uint32_t    i; 
+    
+    ssd1362_init(); 
+    
+    // The content of the controller RAM is unknown until the first frame. 
+    page_draw(values); 
+    bytes = frame_send(); 
+    report("first frame", bytes); 
+    CHECK(bytes == BUFFER_SIZE, "first frame sent %u bytes", bytes); 
+    CHECK(screen_matches(), "first frame"); 
+    
+    // The whole page is redrawn every pass, only one value changed. 
+    page_draw(new_values); 
+    bytes = frame_send(); 
+    report("page redraw, one value", bytes); 
+    CHECK(bytes > 0 && bytes < (BUFFER_SIZE) / 4, "one value sent %u bytes", bytes); 
+    CHECK(screen_matches(), "page redraw, one value"); 
+    
+    // Same page again: nothing changed on screen. 
+    page_draw(new_values); 
+    bytes = frame_send(); 
+    report("page redraw, no change", bytes); 
+    CHECK(bytes == 0, "unchanged page sent %u bytes", bytes); 
+    
+    // Values redrawn in place in two distant slots. 
+    value_draw(0, "999"); 
+    value_draw(3, "12"); 
+    bytes = frame_send(); 
+    report("two values in place", bytes); 
+    CHECK(bytes < (BUFFER_SIZE) / 2, "two values sent %u bytes", bytes); 
+    CHECK(screen_matches(), "two values in place"); 
+    
+    // Drawing while a frame is being sent goes to the back buffer. 
+    value_draw(1, "19.5"); 
+    SSD1362_refresh(); 
+    SSD1362_task(); 
+    value_draw(2, "7"); 
+    host_dma_run(); 
+    frame_send(); 
+    CHECK(screen_matches(), "drawing during a transfer"); 
+    
+    // Random pixels everywhere, the window still covers every change. 
+    for (i = 0; i < 200; i += 1)
+    {
+        display_set_pixel(test_random() % DISPLAY_WIDTH, test_random() % DISPLAY_HEIGHT, test_random() & 0x0F); 
+        if (i % 20 == 0)
+        {
+            frame_send(); 
+            CHECK(screen_matches(), "random pixels %u", i); 
+        }
+    }
+    
+    frame_send(); 
+    CHECK(screen_matches(), "random pixels"); 
+    printf("  %u frames sent, %u skipped\n", SSD1362_stats.frames_sent, SSD1362_stats.frames_skipped); 
+    
+    return test_report("ssd1362"); 
+}
@@ -0,0 +1,145 @@
+#!/usr/bin/env python3
+"""Convert a grayscale image to a run-length encoded 4bpp SSD1362 asset.
+
+The output is a C array that can be pasted in src/ui/assets.c and drawn with
+display_img_rle(). See display_img_rle() in src/drivers/ssd1362.h for the
+packet format.
+
+PGM files (P2 and P5) are read natively, other formats such as PNG need
+Pillow. Gray levels are scaled so that white maps to --max-intensity.
+
+    usage: img2rle.py image.png [--name MENU_LEFT] [--max-intensity 14] [--raw]
+"""
+
+import argparse
+import sys
+
+
+RLE_LITERAL_FLAG = 0x80
+RLE_MAX_COUNT = 128
+RLE_MIN_RUN = 3
+
+
+def read_pgm(path):
+    with open(path, "rb") as f:
+        data = f.read()
+
+    # Split the header tokens while skipping comments.
+    tokens = []
+    pos = 0
+    while len(tokens) < 4:
+        while data[pos:pos + 1].isspace():
+            pos += 1
+        if data[pos:pos + 1] == b"#":
+            while data[pos:pos + 1] not in (b"\n", b""):
+                pos += 1
+            continue
+        start = pos
+        while not data[pos:pos + 1].isspace():
+            pos += 1
+        tokens.append(data[start:pos])
+
+    magic, width, height, maxval = tokens[0], int(tokens[1]), int(tokens[2]), int(tokens[3])
+    if magic == b"P5":
+        if maxval > 255:
+            raise ValueError("16-bit PGM files are not supported")
+        pixels = list(data[pos + 1:pos + 1 + width * height])
+    elif magic == b"P2":
+        pixels = [int(v) for v in data[pos:].split()[:width * height]]
+    else:
+        raise ValueError("not a grayscale PGM file")
+
+    return width, height, maxval, pixels
+
+
+def read_image(path):
+    if path.lower().endswith((".pgm", ".pnm")):
+        return read_pgm(path)
+
+    try:
+        from PIL import Image
+    except ImportError:
+        sys.exit("Pillow is required to read %s, convert it to PGM instead." % path)
+
+    image = Image.open(path).convert("L")
+    return image.width, image.height, 255, list(image.getdata())
+
+
+def quantize(width, height, maxval, pixels, max_intensity):
+    # Rows are padded to an even width, like the raw nibble-packed assets.
+    padded = width + width % 2
+    out = []
+    for y in range(height):
+        row = pixels[y * width:(y + 1) * width]
+        out += [(v * max_intensity + maxval // 2) // maxval for v in row]
+        out += [0] * (padded - width)
+    return out
+
+
+def encode(pixels):
+    out = bytearray()
+    literal = []
+
+    def flush():
+        for i in range(0, len(literal), RLE_MAX_COUNT):
+            chunk = literal[i:i + RLE_MAX_COUNT]
+            out.append(RLE_LITERAL_FLAG | (len(chunk) - 1))
+            chunk = chunk + [0] * (len(chunk) % 2)
+            out.extend((chunk[j] << 4) | chunk[j + 1] for j in range(0, len(chunk), 2))
+        literal.clear()
+
+    i = 0
+    while i < len(pixels):
+        run = 1
+        while i + run < len(pixels) and pixels[i + run] == pixels[i] and run < RLE_MAX_COUNT:
+            run += 1
+
+        # Short runs cost less as part of a literal packet.
+        if run >= RLE_MIN_RUN:
+            flush()
+            out += bytes((run - 1, pixels[i]))
+        else:
+            literal.extend(pixels[i:i + run])
+        i += run
+
+    flush()
+    return out
+
+
+def pack_raw(pixels):
+    return bytearray((pixels[i] << 4) | pixels[i + 1] for i in range(0, len(pixels), 2))
+
+
+def to_c_array(name, data, comment):
+    lines = ["// %s" % comment, "const uint8_t %s[] = {" % name]
+    for i in range(0, len(data), 12):
+        lines.append("    " + "".join("0x%02X, " % b for b in data[i:i + 12]))
+    lines.append("};")
+    return "\n".join(lines)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("image")
+    parser.add_argument("--name", default="IMAGE", help="asset name, without the _ASSET suffix")
+    parser.add_argument("--max-intensity", type=int, default=14, help="intensity of white pixels (0-15)")
+    parser.add_argument("--raw", action="store_true", help="emit the raw nibble-packed array instead")
+    args = parser.parse_args()
+
+    width, height, maxval, pixels = read_image(args.image)
+    pixels = quantize(width, height, maxval, pixels, args.max_intensity)
+    raw = pack_raw(pixels)
+    rle = encode(pixels)
+
+    if args.raw:
+        data, comment = raw, "%dx%d raw image, %d bytes." % (width, height, len(raw))
+    else:
+        data, comment = rle, "%dx%d RLE image, %d bytes (%d raw)." % (width, height, len(rle), len(raw))
+
+    print(to_c_array(args.name + "_ASSET", data, comment))
+    sys.stderr.write("%s: %d raw bytes, %d RLE bytes, ratio %.2f\n"
+                     % (args.name, len(raw), len(rle), len(raw) / len(rle)))
+
+
+if __name__ == "__main__":
+    main()
@@ -88,7 +88,6 @@ extern void EIC_OTHER_Handler          ( void ) __attribute__((weak, alias("Dumm
 extern void FREQM_Handler              ( void ) __attribute__((weak, alias("Dummy_Handler"),noreturn));
 extern void NVMCTRL_Handler            ( void ) __attribute__((weak, alias("Dummy_Handler"),noreturn));
 extern void PORT_Handler               ( void ) __attribute__((weak, alias("Dummy_Handler"),noreturn));
-extern void DMAC_1_Handler             ( void ) __attribute__((weak, alias("Dummy_Handler"),noreturn));
 extern void DMAC_2_Handler             ( void ) __attribute__((weak, alias("Dummy_Handler"),noreturn));
 extern void DMAC_3_Handler             ( void ) __attribute__((weak, alias("Dummy_Handler"),noreturn));
 extern void DMAC_OTHER_Handler         ( void ) __attribute__((weak, alias("Dummy_Handler"),noreturn));
@@ -154,7 +153,6 @@ const H3DeviceVectors exception_table=
     .pfnFREQM_Handler              = FREQM_Handler,
     .pfnNVMCTRL_Handler            = NVMCTRL_Handler,
     .pfnPORT_Handler               = PORT_Handler,
-    .pfnDMAC_1_Handler             = DMAC_1_Handler,
     .pfnDMAC_2_Handler             = DMAC_2_Handler,
     .pfnDMAC_3_Handler             = DMAC_3_Handler,
     .pfnDMAC_OTHER_Handler         = DMAC_OTHER_Handler,
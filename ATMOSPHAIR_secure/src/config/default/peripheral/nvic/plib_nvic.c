@@ -60,6 +60,7 @@ void NVIC_Initialize( void )
     NVIC_SetTargetState(EIC_EXTINT_1_IRQn);
     NVIC_SetTargetState(EIC_EXTINT_2_IRQn);
     NVIC_SetTargetState(DMAC_0_IRQn);
+    NVIC_SetTargetState(DMAC_1_IRQn);
     NVIC_SetTargetState(SERCOM0_0_IRQn);
     NVIC_SetTargetState(SERCOM0_1_IRQn);
     NVIC_SetTargetState(SERCOM0_2_IRQn);